@@ -0,0 +1,357 @@
+/* boost random/alias_table.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_ALIAS_TABLE_HPP
+#define BOOST_RANDOM_ALIAS_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
+#include <initializer_list>
+#endif
+
+#include "generate_canonical_bulk.hpp"
+#include "uniform_bounded.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * An entry of the alias table, 8 bytes: a bucket yields itself if the
+     * 32-bit fraction is less than threshold and alias otherwise.
+     */
+    struct alias_entry
+    {
+        std::uint32_t threshold;
+        std::uint32_t alias;
+    };
+
+    /**
+     * The bucket of the 64 random bits x, the high word of x * n, the
+     * upper half of the low word is the fraction within the bucket.
+     */
+    inline std::uint32_t alias_bucket(std::uint64_t x, std::uint64_t n, std::uint32_t& fraction)
+    {
+        std::uint64_t lo;
+        const std::uint64_t hi = mul_128(x, n, lo);
+        fraction = static_cast<std::uint32_t>(lo >> 32);
+        return static_cast<std::uint32_t>(hi);
+    }
+
+    inline std::uint32_t alias_resolve(const alias_entry* table, std::uint32_t bucket, std::uint32_t fraction)
+    {
+        const alias_entry e = table[bucket];
+        return fraction < e.threshold ? bucket : e.alias;
+    }
+
+} // namespace detail
+
+/**
+ * The class @c alias_discrete_distribution models a \random_distribution.
+ * It produces integers in the range [0, n) with the probability of
+ * producing each value is specified by the parameters of the
+ * distribution, as boost::random::discrete_distribution.
+ *
+ * The distribution samples from a Vose alias table with one 64-bit draw
+ * per sample: the draw x selects the bucket (the high word of x * n) and
+ * the upper half of the low word is compared with the 32-bit threshold of
+ * the bucket. An entry packs the threshold and the alias in 8 bytes, the
+ * probabilities are therefore rounded down to multiples of 2^-32 / n.
+ *
+ * generate() samples in blocks and prefetches the entries of a block
+ * before resolving them, which hides the cache misses of large tables
+ * (10^5 categories and up).
+ *
+ * The number of categories must be less than 2^32.
+ */
+template<class IntType = int>
+class alias_discrete_distribution
+{
+public:
+    typedef IntType input_type;
+    typedef IntType result_type;
+
+    class param_type
+    {
+    public:
+        typedef alias_discrete_distribution distribution_type;
+
+        /**
+         * Constructs a @c param_type object, representing a distribution
+         * with \f$p(0) = 1\f$ and \f$p(k|k>0) = 0\f$.
+         */
+        param_type() : _probabilities(1, 1.0) {}
+
+        /**
+         * If @c first == @c last, equivalent to the default constructor.
+         * Otherwise, the values of the range represent weights for the
+         * possible values of the distribution.
+         */
+        template<class Iter>
+        param_type(Iter first, Iter last) : _probabilities(first, last)
+        { normalize(); }
+
+#ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
+        /**
+         * If @c wl.size() == 0, equivalent to the default constructor.
+         * Otherwise, the values of the @c initializer_list represent weights
+         * for the possible values of the distribution.
+         */
+        param_type(const std::initializer_list<double>& wl) : _probabilities(wl)
+        { normalize(); }
+#endif
+
+        /** Returns a vector containing the probabilities of each value. */
+        std::vector<double> probabilities() const { return _probabilities; }
+
+        /** Returns true if the two sets of parameters are the same. */
+        friend bool operator==(const param_type& lhs, const param_type& rhs)
+        { return lhs._probabilities == rhs._probabilities; }
+
+        /** Returns true if the two sets of parameters are different. */
+        friend bool operator!=(const param_type& lhs, const param_type& rhs)
+        { return !(lhs == rhs); }
+
+    private:
+        /// \cond show_private
+
+        void normalize()
+        {
+            if (_probabilities.empty()) {
+                _probabilities.push_back(1.0);
+                return;
+            }
+            const double sum = std::accumulate(_probabilities.begin(), _probabilities.end(), 0.0);
+            BOOST_ASSERT(sum > 0.0);
+            for (std::size_t i = 0; i < _probabilities.size(); ++i) {
+                _probabilities[i] /= sum;
+            }
+        }
+
+        /// \endcond
+
+        std::vector<double> _probabilities;
+    };
+
+    /**
+     * Creates a new @c alias_discrete_distribution object that has
+     * \f$p(0) = 1\f$ and \f$p(i|i>0) = 0\f$.
+     */
+    alias_discrete_distribution() { init(param_type()); }
+
+    /**
+     * Constructs a alias_discrete_distribution from an iterator range.
+     * If @c first == @c last, equivalent to the default constructor.
+     * Otherwise, the values of the range represent weights for the
+     * possible values of the distribution.
+     */
+    template<class Iter>
+    alias_discrete_distribution(Iter first, Iter last)
+    { init(param_type(first, last)); }
+
+#ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
+    /**
+     * Constructs a @c alias_discrete_distribution from a
+     * @c std::initializer_list. If the @c initializer_list is empty,
+     * equivalent to the default constructor. Otherwise, the values of the
+     * @c initializer_list represent weights for the possible values of
+     * the distribution.
+     */
+    alias_discrete_distribution(std::initializer_list<double> wl)
+    { init(param_type(wl)); }
+#endif
+
+    /**
+     * Constructs a alias_discrete_distribution from its parameters.
+     */
+    explicit alias_discrete_distribution(const param_type& parm)
+    { init(parm); }
+
+    /**
+     * Returns a value distributed according to the parameters of the
+     * alias_discrete_distribution, from one 64-bit draw of @c eng (two
+     * 32-bit draws, the first in the low word, for a 32-bit engine).
+     */
+    template<class Engine>
+    result_type operator()(Engine& eng) const
+    {
+        std::uint32_t fraction;
+        const std::uint32_t bucket = detail::alias_bucket(detail::bounded_bits(eng, boost::false_type()), _table.size(), fraction);
+        return static_cast<result_type>(detail::alias_resolve(_table.data(), bucket, fraction));
+    }
+
+    /**
+     * Returns a value distributed according to the parameters
+     * specified by param.
+     */
+    template<class Engine>
+    result_type operator()(Engine& eng, const param_type& parm) const
+    {
+        return alias_discrete_distribution(parm)(eng);
+    }
+
+    /**
+     * Writes @c n values distributed according to the parameters of the
+     * alias_discrete_distribution to @c out. The draws are made in
+     * blocks, through generate() if the engine has a vectorized one, the
+     * entries of a block are prefetched before they are resolved. The
+     * values are those of n calls of operator().
+     */
+    template<class Engine, class OutputIt>
+    void generate(Engine& eng, OutputIt out, std::size_t n) const
+    {
+        const std::size_t block_size = detail::canonical_block_size;
+        const detail::alias_entry* table = _table.data();
+        std::uint64_t bits[block_size];
+        std::uint32_t buckets[block_size], fractions[block_size];
+        while (n) {
+            const std::size_t m = (std::min)(n, block_size);
+            detail::canonical_bits(eng, bits, m, detail::canonical_by_generate<Engine>());
+            for (std::size_t i = 0; i < m; ++i) {
+                buckets[i] = detail::alias_bucket(bits[i], _table.size(), fractions[i]);
+                detail::prefetch(table + buckets[i]);
+            }
+            for (std::size_t i = 0; i < m; ++i, ++out) {
+                *out = static_cast<result_type>(detail::alias_resolve(table, buckets[i], fractions[i]));
+            }
+            n -= m;
+        }
+    }
+
+    /** Returns the smallest value that the distribution can produce. */
+    result_type min BOOST_PREVENT_MACRO_SUBSTITUTION () const { return 0; }
+    /** Returns the largest value that the distribution can produce. */
+    result_type max BOOST_PREVENT_MACRO_SUBSTITUTION () const
+    { return static_cast<result_type>(_table.size() - 1); }
+
+    /**
+     * Returns a vector containing the probabilities of each
+     * value of the distribution, as represented by the table.
+     */
+    std::vector<double> probabilities() const
+    {
+        const double scale = 1.0 / (4294967296.0 * static_cast<double>(_table.size()));
+        std::vector<double> result(_table.size(), 0.0);
+        for (std::size_t i = 0; i < _table.size(); ++i) {
+            const std::uint32_t t = _table[i].threshold;
+            result[i] += static_cast<double>(t) * scale;
+            result[_table[i].alias] += (4294967296.0 - static_cast<double>(t)) * scale;
+        }
+        return result;
+    }
+
+    /** Returns the parameters of the distribution. */
+    param_type param() const
+    {
+        const std::vector<double> p(probabilities());
+        return param_type(p.begin(), p.end());
+    }
+    /** Sets the parameters of the distribution. */
+    void param(const param_type& parm) { init(parm); }
+
+    /**
+     * Effects: Subsequent uses of the distribution do not depend
+     * on values produced by any engine prior to invoking reset.
+     */
+    void reset() {}
+
+    /**
+     * Returns true if the two distributions will return the
+     * same sequence of values, when passed equal generators.
+     */
+    friend bool operator==(const alias_discrete_distribution& lhs, const alias_discrete_distribution& rhs)
+    {
+        if (lhs._table.size() != rhs._table.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs._table.size(); ++i) {
+            if (lhs._table[i].threshold != rhs._table[i].threshold || lhs._table[i].alias != rhs._table[i].alias) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /**
+     * Returns true if the two distributions may return different
+     * sequences of values, when passed equal generators.
+     */
+    friend bool operator!=(const alias_discrete_distribution& lhs, const alias_discrete_distribution& rhs)
+    { return !(lhs == rhs); }
+
+private:
+    /// \cond show_private
+
+    // Vose's construction of the alias table.
+    void init(const param_type& parm)
+    {
+        const std::vector<double> p(parm.probabilities());
+        const std::size_t n = p.size();
+        BOOST_ASSERT(n <= (std::numeric_limits<std::uint32_t>::max)());
+
+        std::vector<double> scaled(n);
+        std::vector<std::uint32_t> small, large;
+        for (std::size_t i = 0; i < n; ++i) {
+            scaled[i] = p[i] * static_cast<double>(n);
+            (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+        }
+
+        _table.resize(n);
+        while (!small.empty() && !large.empty()) {
+            const std::uint32_t s = small.back(), l = large.back();
+            small.pop_back();
+            _table[s].threshold = threshold(scaled[s]);
+            _table[s].alias = l;
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+            if (scaled[l] < 1.0) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        // The remainder has probability 1, up to rounding.
+        for (std::size_t i = 0; i < large.size(); ++i) {
+            _table[large[i]].threshold = (std::numeric_limits<std::uint32_t>::max)();
+            _table[large[i]].alias = large[i];
+        }
+        for (std::size_t i = 0; i < small.size(); ++i) {
+            _table[small[i]].threshold = (std::numeric_limits<std::uint32_t>::max)();
+            _table[small[i]].alias = small[i];
+        }
+    }
+
+    static std::uint32_t threshold(double p)
+    {
+        return p <= 0.0 ? 0 : p >= 1.0 ? (std::numeric_limits<std::uint32_t>::max)()
+                                       : static_cast<std::uint32_t>(p * 4294967296.0);
+    }
+
+    std::vector<detail::alias_entry> _table;
+
+    /// \endcond
+};
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_ALIAS_TABLE_HPP
@@ -0,0 +1,243 @@
+/* boost random/async_random_pool.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_ASYNC_RANDOM_POOL_HPP
+#define BOOST_RANDOM_ASYNC_RANDOM_POOL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/align/aligned_allocator.hpp>
+
+#include "bounded_ring.hpp"
+#include "buffered_engine.hpp"
+
+namespace boost {
+namespace random {
+
+/**
+ * An async_random_pool hands out the outputs of background producer
+ * threads to latency-critical threads. The producers fill blocks of
+ * @c BlockBytes bytes with the bulk generation of the engine (as
+ * buffered_engine) and publish them through a lock-free bounded ring
+ * (Vyukov's multi-producer multi-consumer queue), the consumers copy a
+ * block at a time out of the ring and hand out its values.
+ *
+ * Each thread draws from a stream of its own: producer i from a copy of
+ * the seed engine advanced by jump() i times, the consumers from the
+ * streams that follow. Engine must therefore have jump(z), as the
+ * engines of xoroshiro.hpp.
+ *
+ * If the ring is empty, a consumer returns a value of its own stream,
+ * so a call never waits for a producer, and counts an underflow. The
+ * consumers must be destroyed before the pool.
+ */
+template<class Engine, std::size_t BlockBytes = 4096>
+class async_random_pool
+{
+public:
+    typedef Engine engine_type;
+    typedef std::uint64_t result_type;
+
+    BOOST_STATIC_ASSERT(std::numeric_limits<typename Engine::result_type>::digits == 64);
+    BOOST_STATIC_ASSERT(BlockBytes >= 64 && BlockBytes % 64 == 0);
+
+    /** The number of values in a block. */
+    BOOST_STATIC_CONSTANT(std::size_t, block_size = BlockBytes / sizeof(result_type));
+
+    /** The counters of the pool, totals since construction. */
+    struct statistics
+    {
+        /** The number of blocks published by the producers. */
+        std::uint64_t blocks;
+        /** The number of values returned by consumers from their own stream. */
+        std::uint64_t underflows;
+        /** The total and the largest time taken to generate a block. */
+        std::chrono::nanoseconds refill_time, max_refill_time;
+    };
+
+    /**
+     * A consumer models a \uniform_random_number_generator and is used by
+     * a single thread. It takes the next free stream of the pool.
+     */
+    class consumer
+    {
+    public:
+        typedef std::uint64_t result_type;
+
+        explicit consumer(async_random_pool& pool)
+          : _pool(&pool), _fallback(pool.next_stream()), _index(block_size) { }
+
+        consumer(const consumer&) = delete;
+        consumer& operator=(const consumer&) = delete;
+
+        /** Returns the next value. */
+        result_type operator()()
+        {
+            if (BOOST_UNLIKELY(_index == block_size)) {
+                return next_block();
+            }
+            return _data[_index++];
+        }
+
+        static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        { return (std::numeric_limits<result_type>::min)(); }
+        static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        { return (std::numeric_limits<result_type>::max)(); }
+
+    private:
+        /// \cond show_private
+
+        BOOST_NOINLINE result_type next_block()
+        {
+            if (_pool->_ring.pop(_data)) {
+                _index = 1;
+                return _data[0];
+            }
+            _pool->_underflows.fetch_add(1, std::memory_order_relaxed);
+            return static_cast<result_type>(_fallback());
+        }
+
+        BOOST_ALIGNMENT(64) result_type _data[block_size];
+        async_random_pool* _pool;
+        engine_type _fallback;
+        std::size_t _index;
+
+        /// \endcond
+    };
+
+    /**
+     * Starts @c producers threads, drawing from streams of @c eng, on a
+     * ring of @c blocks blocks (rounded up to a power of 2).
+     */
+    explicit async_random_pool(const engine_type& eng, std::size_t blocks = 16, std::size_t producers = 1)
+      : _ring(blocks), _eng(eng)
+    {
+        BOOST_ASSERT(producers >= 1);
+        _streams.store(0, std::memory_order_relaxed);
+        _stop.store(false, std::memory_order_relaxed);
+        _blocks.store(0, std::memory_order_relaxed);
+        _underflows.store(0, std::memory_order_relaxed);
+        _refill_ns.store(0, std::memory_order_relaxed);
+        _max_refill_ns.store(0, std::memory_order_relaxed);
+        try {
+            for (std::size_t i = 0; i < producers; ++i) {
+                _producers.emplace_back(&async_random_pool::produce, this, next_stream());
+            }
+        }
+        catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    async_random_pool(const async_random_pool&) = delete;
+    async_random_pool& operator=(const async_random_pool&) = delete;
+
+    /** Stops and joins the producers. */
+    ~async_random_pool() { stop(); }
+
+    /** Returns the counters of the pool. */
+    statistics stats() const
+    {
+        statistics s;
+        s.blocks = _blocks.load(std::memory_order_relaxed);
+        s.underflows = _underflows.load(std::memory_order_relaxed);
+        s.refill_time = std::chrono::nanoseconds(_refill_ns.load(std::memory_order_relaxed));
+        s.max_refill_time = std::chrono::nanoseconds(_max_refill_ns.load(std::memory_order_relaxed));
+        return s;
+    }
+
+private:
+    /// \cond show_private
+
+    engine_type next_stream()
+    {
+        engine_type eng(_eng);
+        eng.jump(_streams.fetch_add(1, std::memory_order_relaxed));
+        return eng;
+    }
+
+    void produce(engine_type eng)
+    {
+        std::vector<result_type, boost::alignment::aligned_allocator<result_type, 64> > block(block_size);
+        while (!_stop.load(std::memory_order_relaxed)) {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            detail::fill_results(eng, block.data(), block_size);
+            record_refill(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+            // The ring is full: spin a little, then sleep.
+            for (unsigned spins = 0; !_ring.push(block.data()); ++spins) {
+                if (_stop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                if (spins < 64) {
+                    std::this_thread::yield();
+                }
+                else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+            _blocks.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void record_refill(std::uint64_t ns)
+    {
+        _refill_ns.fetch_add(ns, std::memory_order_relaxed);
+        std::uint64_t max = _max_refill_ns.load(std::memory_order_relaxed);
+        while (ns > max && !_max_refill_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) { }
+    }
+
+    void stop()
+    {
+        _stop.store(true, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < _producers.size(); ++i) {
+            _producers[i].join();
+        }
+        _producers.clear();
+    }
+
+    detail::bounded_ring<result_type, block_size> _ring;
+    const engine_type _eng;
+    std::vector<std::thread> _producers;
+
+    // The counters written by producers and consumers are on cache lines
+    // of their own.
+    BOOST_ALIGNMENT(64) std::atomic<std::uint64_t> _underflows;
+    BOOST_ALIGNMENT(64) std::atomic<std::uint64_t> _blocks;
+    std::atomic<std::uint64_t> _refill_ns;
+    std::atomic<std::uint64_t> _max_refill_ns;
+    std::atomic<std::uintmax_t> _streams;
+    std::atomic<bool> _stop;
+
+    /// \endcond
+};
+
+#ifndef BOOST_NO_INCLASS_MEMBER_INITIALIZATION
+//  A definition is required even for integral static constants
+template<class Engine, std::size_t BlockBytes>
+const std::size_t async_random_pool<Engine, BlockBytes>::block_size;
+#endif
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_ASYNC_RANDOM_POOL_HPP
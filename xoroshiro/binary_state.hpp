@@ -0,0 +1,512 @@
+/* boost random/binary_state.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_BINARY_STATE_HPP
+#define BOOST_RANDOM_BINARY_STATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#endif
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "xoroshiro.hpp"
+#include "complementary_multiply_with_carry.hpp"
+#include "linear_feedback_shift.hpp"
+#include "xor_combine.hpp"
+
+namespace boost {
+namespace random {
+
+/// \cond show_private
+
+namespace detail {
+
+    /**
+     * The writer and reader of the state words: 32-bit words, little
+     * endian whatever the byte order of the platform, a 64-bit word is
+     * written as two 32-bit words, the low word first.
+     */
+    struct binary_state_writer
+    {
+        unsigned char* p;
+
+        void put32(std::uint32_t x)
+        {
+            p[0] = static_cast<unsigned char>(x), p[1] = static_cast<unsigned char>(x >> 8);
+            p[2] = static_cast<unsigned char>(x >> 16), p[3] = static_cast<unsigned char>(x >> 24);
+            p += 4;
+        }
+
+        void put64(std::uint64_t x)
+        {
+            put32(static_cast<std::uint32_t>(x)), put32(static_cast<std::uint32_t>(x >> 32));
+        }
+    };
+
+    struct binary_state_reader
+    {
+        const unsigned char* p;
+
+        std::uint32_t get32()
+        {
+            const std::uint32_t x = static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8
+                | static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24;
+            p += 4;
+            return x;
+        }
+
+        std::uint64_t get64()
+        {
+            const std::uint64_t lo = get32();
+            return lo | static_cast<std::uint64_t>(get32()) << 32;
+        }
+    };
+
+    /**
+     * binary_state_access<Engine> describes the binary state of Engine:
+     * id(), a name of the engine and of its parameters that does not
+     * depend on the compiler, words, the number of 32-bit words of the
+     * state, and save() and load(), which write and read them. load()
+     * throws std::invalid_argument on a state the engine can not have.
+     */
+
+    // The engines of xoroshiro.hpp with a state of 64-bit words _s, that
+    // must not be all zero.
+#define BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(Engine)                                      \
+    template<>                                                                              \
+    struct binary_state_access<Engine>                                                      \
+    {                                                                                       \
+        static std::string id() { return #Engine; }                                         \
+        BOOST_STATIC_CONSTANT(std::size_t, words = sizeof(Engine::_s) / 4);                 \
+        static void save(const Engine& eng, binary_state_writer& out)                       \
+        {                                                                                   \
+            for (std::size_t j = 0; j < words / 2; ++j) {                                   \
+                out.put64(eng._s[j]);                                                       \
+            }                                                                               \
+        }                                                                                   \
+        static void load(Engine& eng, binary_state_reader& in)                              \
+        {                                                                                   \
+            std::uint64_t any = 0;                                                          \
+            for (std::size_t j = 0; j < words / 2; ++j) {                                   \
+                any |= (eng._s[j] = in.get64());                                            \
+            }                                                                               \
+            if (!any) {                                                                     \
+                throw std::invalid_argument("binary engine state all zero");                \
+            }                                                                               \
+        }                                                                                   \
+    };
+
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xoroshiro128plus)
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xoshiro256starstar)
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xoshiro256plus)
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xoroshiro128plusshixo)
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xoroshiro128plusshixostar)
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xoroshiro128plusshixostarshixo)
+    BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS(xorshift128plus)
+
+#undef BOOST_RANDOM_DETAIL_BINARY_STATE_WORDS
+
+    // The state and the gamma, which is odd.
+    template<>
+    struct binary_state_access<splitmix64>
+    {
+        static std::string id() { return "splitmix64"; }
+        BOOST_STATIC_CONSTANT(std::size_t, words = 4);
+        static void save(const splitmix64& eng, binary_state_writer& out)
+        {
+            out.put64(eng._s[0]), out.put64(eng._gamma);
+        }
+        static void load(splitmix64& eng, binary_state_reader& in)
+        {
+            eng._s[0] = in.get64(), eng._gamma = in.get64();
+            if (!(eng._gamma & 1)) {
+                throw std::invalid_argument("binary engine state with an even gamma");
+            }
+        }
+    };
+
+    // The 16 words of the state and the position.
+    template<>
+    struct binary_state_access<xorshift1024star>
+    {
+        static std::string id() { return "xorshift1024star"; }
+        BOOST_STATIC_CONSTANT(std::size_t, words = 33);
+        static void save(const xorshift1024star& eng, binary_state_writer& out)
+        {
+            for (std::size_t j = 0; j < 16; ++j) {
+                out.put64(eng._s[j]);
+            }
+            out.put32(static_cast<std::uint32_t>(eng._p));
+        }
+        static void load(xorshift1024star& eng, binary_state_reader& in)
+        {
+            std::uint64_t any = 0;
+            for (std::size_t j = 0; j < 16; ++j) {
+                any |= (eng._s[j] = in.get64());
+            }
+            eng._p = in.get32();
+            if (!any || eng._p >= 16) {
+                throw std::invalid_argument("binary engine state invalid");
+            }
+        }
+    };
+
+    template<class UIntType, int w, int k, int q, int s>
+    struct binary_state_access<linear_feedback_shift_engine<UIntType, w, k, q, s> >
+    {
+        typedef linear_feedback_shift_engine<UIntType, w, k, q, s> engine_type;
+
+        static std::string id()
+        {
+            return "linear_feedback_shift_engine<" + std::to_string(std::numeric_limits<UIntType>::digits) + ","
+                + std::to_string(w) + "," + std::to_string(k) + "," + std::to_string(q) + "," + std::to_string(s) + ">";
+        }
+        BOOST_STATIC_CONSTANT(std::size_t, words = std::numeric_limits<UIntType>::digits > 32 ? 2 : 1);
+        static void save(const engine_type& eng, binary_state_writer& out)
+        {
+            if (words == 2) {
+                out.put64(static_cast<std::uint64_t>(eng.value));
+            }
+            else {
+                out.put32(static_cast<std::uint32_t>(eng.value));
+            }
+        }
+        static void load(engine_type& eng, binary_state_reader& in)
+        {
+            eng.value = static_cast<UIntType>(words == 2 ? in.get64() : in.get32());
+        }
+    };
+
+    // The states of the base generators, one after the other.
+    template<class URNG1, int s1, class URNG2, int s2>
+    struct binary_state_access<xor_combine_engine<URNG1, s1, URNG2, s2> >
+    {
+        typedef xor_combine_engine<URNG1, s1, URNG2, s2> engine_type;
+
+        static std::string id()
+        {
+            return "xor_combine_engine<" + binary_state_access<URNG1>::id() + "," + std::to_string(s1) + ","
+                + binary_state_access<URNG2>::id() + "," + std::to_string(s2) + ">";
+        }
+        BOOST_STATIC_CONSTANT(std::size_t, words = binary_state_access<URNG1>::words + binary_state_access<URNG2>::words);
+        static void save(const engine_type& eng, binary_state_writer& out)
+        {
+            binary_state_access<URNG1>::save(eng._rng1, out);
+            binary_state_access<URNG2>::save(eng._rng2, out);
+        }
+        static void load(engine_type& eng, binary_state_reader& in)
+        {
+            binary_state_access<URNG1>::load(eng._rng1, in);
+            binary_state_access<URNG2>::load(eng._rng2, in);
+        }
+    };
+
+    // The lag table, the index and the carry.
+    template<typename IntType, std::size_t w, std::size_t CMWC_CYCLE, std::uint32_t CMWC_C_MAX, std::uint64_t A, bool is_complementary>
+    struct binary_state_access<complementary_multiply_with_carry_engine<IntType, w, CMWC_CYCLE, CMWC_C_MAX, A, is_complementary> >
+    {
+        typedef complementary_multiply_with_carry_engine<IntType, w, CMWC_CYCLE, CMWC_C_MAX, A, is_complementary> engine_type;
+
+        BOOST_STATIC_ASSERT(std::numeric_limits<IntType>::digits <= 32);
+
+        static std::string id()
+        {
+            return "complementary_multiply_with_carry_engine<" + std::to_string(std::numeric_limits<IntType>::digits) + ","
+                + std::to_string(w) + "," + std::to_string(CMWC_CYCLE) + "," + std::to_string(CMWC_C_MAX) + ","
+                + std::to_string(A) + "," + std::to_string(int { is_complementary }) + ">";
+        }
+        BOOST_STATIC_CONSTANT(std::size_t, words = CMWC_CYCLE + 2);
+        static void save(const engine_type& eng, binary_state_writer& out)
+        {
+            for (std::size_t j = 0; j < CMWC_CYCLE; ++j) {
+                out.put32(static_cast<std::uint32_t>(eng._Q[j]));
+            }
+            out.put32(static_cast<std::uint32_t>(eng._i));
+            out.put32(static_cast<std::uint32_t>(eng._carry));
+        }
+        static void load(engine_type& eng, binary_state_reader& in)
+        {
+            for (std::size_t j = 0; j < CMWC_CYCLE; ++j) {
+                eng._Q[j] = static_cast<IntType>(in.get32());
+            }
+            eng._i = in.get32();
+            eng._carry = static_cast<IntType>(in.get32());
+            if (eng._i >= CMWC_CYCLE) {
+                throw std::invalid_argument("binary engine state invalid");
+            }
+        }
+    };
+
+    /**
+     * The header of a binary engine state, binary_state_header_size bytes,
+     * written as the state words: the magic "ENST", the version and the
+     * header size (16 bits each, in one word), the FNV-1a hash of the id()
+     * of the engine, the number of state words per engine, a reserved
+     * word, the number of engines, and zeros up to the header size. The
+     * engines follow, each as its state words.
+     */
+    const std::size_t binary_state_header_size = 64;
+    const std::uint32_t binary_state_magic = 0x54534E45; // "ENST"
+    const std::uint32_t binary_state_version = 2;
+
+    // FNV-1a of the id of Engine.
+    template<class Engine>
+    inline std::uint64_t binary_state_tag()
+    {
+        static const std::uint64_t tag = [] {
+            const std::string id = binary_state_access<Engine>::id();
+            std::uint64_t h = 0xCBF29CE484222325;
+            for (std::size_t i = 0; i < id.size(); ++i) {
+                h = (h ^ static_cast<unsigned char>(id[i])) * std::uint64_t { 0x100000001B3 };
+            }
+            return h;
+        }();
+        return tag;
+    }
+
+    template<class Engine>
+    BOOST_CONSTEXPR std::size_t binary_state_engine_size()
+    {
+        return 4 * binary_state_access<Engine>::words;
+    }
+
+    template<class Engine>
+    inline void write_binary_state_header(void* out, std::uint64_t count)
+    {
+        std::memset(out, 0, binary_state_header_size);
+        binary_state_writer w = { static_cast<unsigned char*>(out) };
+        w.put32(binary_state_magic);
+        w.put32(binary_state_version | static_cast<std::uint32_t>(binary_state_header_size) << 16);
+        w.put64(binary_state_tag<Engine>());
+        w.put32(static_cast<std::uint32_t>(binary_state_access<Engine>::words));
+        w.put32(0);
+        w.put64(count);
+    }
+
+    /**
+     * Reads the header at in and returns the number of engines, throws
+     * std::invalid_argument if the header does not describe Engine or
+     * size bytes do not hold the engines.
+     */
+    template<class Engine>
+    inline std::uint64_t check_binary_state_header(const void* in, std::size_t size)
+    {
+        if (size < binary_state_header_size) {
+            throw std::invalid_argument("binary engine state truncated");
+        }
+        binary_state_reader r = { static_cast<const unsigned char*>(in) };
+        if (r.get32() != binary_state_magic) {
+            throw std::invalid_argument("not a binary engine state");
+        }
+        const std::uint32_t version = r.get32();
+        if ((version & 0xFFFF) != binary_state_version || version >> 16 != binary_state_header_size) {
+            throw std::invalid_argument("unsupported binary engine state version");
+        }
+        const std::uint64_t tag = r.get64();
+        const std::uint32_t words = r.get32();
+        if (tag != binary_state_tag<Engine>() || words != binary_state_access<Engine>::words) {
+            throw std::invalid_argument("binary engine state of another engine");
+        }
+        r.get32();
+        const std::uint64_t count = r.get64();
+        if ((size - binary_state_header_size) / binary_state_engine_size<Engine>() < count) {
+            throw std::invalid_argument("binary engine state truncated");
+        }
+        return count;
+    }
+
+    // Reads the engine at in into eng, which is unchanged if it throws.
+    template<class Engine>
+    inline void load_binary_state(Engine& eng, const unsigned char* in)
+    {
+        Engine e(eng);
+        binary_state_reader r = { in };
+        binary_state_access<Engine>::load(e, r);
+        eng = e;
+    }
+
+} // namespace detail
+
+/// \endcond
+
+/**
+ * Returns the number of bytes save() writes for an @c Engine: a
+ * versioned header and the state words of the engine.
+ */
+template<class Engine>
+BOOST_CONSTEXPR std::size_t binary_state_size()
+{
+    return detail::binary_state_header_size + detail::binary_state_engine_size<Engine>();
+}
+
+/**
+ * Writes the state of @c eng to [out, out + size), as a versioned header
+ * and the state words of the engine, and returns the number of bytes
+ * written, binary_state_size<Engine>(). The format is fixed: 32-bit
+ * little endian words, the engine tagged with the hash of a name of the
+ * engine and its parameters, a state saved by one build (compiler,
+ * ABI, byte order) loads in any other. load() restores the engine bit
+ * for bit, unlike operator<< and operator>>, which format each word in
+ * decimal and depend on the flags of the stream.
+ *
+ * Engine is an engine of xoroshiro.hpp, of
+ * complementary_multiply_with_carry.hpp, a linear_feedback_shift_engine
+ * or a xor_combine_engine of those (taus88, lfsr113). Throws
+ * std::invalid_argument if size is less than binary_state_size<Engine>().
+ */
+template<class Engine>
+std::size_t save(const Engine& eng, void* out, std::size_t size)
+{
+    if (size < binary_state_size<Engine>()) {
+        throw std::invalid_argument("binary engine state buffer too small");
+    }
+    detail::write_binary_state_header<Engine>(out, 1);
+    detail::binary_state_writer w = { static_cast<unsigned char*>(out) + detail::binary_state_header_size };
+    detail::binary_state_access<Engine>::save(eng, w);
+    return binary_state_size<Engine>();
+}
+
+/**
+ * Restores @c eng from a state written by save(). Throws
+ * std::invalid_argument if [in, in + size) does not hold the state of an
+ * @c Engine, @c eng is unchanged then.
+ */
+template<class Engine>
+void load(Engine& eng, const void* in, std::size_t size)
+{
+    if (detail::check_binary_state_header<Engine>(in, size) != 1) {
+        throw std::invalid_argument("binary engine state holds more than one engine");
+    }
+    detail::load_binary_state(eng, static_cast<const unsigned char*>(in) + detail::binary_state_header_size);
+}
+
+#if defined(__cpp_lib_span)
+/** Writes the state of @c eng to @c out, see save(eng, out, size). */
+template<class Engine>
+std::size_t save(const Engine& eng, std::span<std::byte> out)
+{
+    return save(eng, out.data(), out.size());
+}
+
+/** Restores @c eng from @c in, see load(eng, in, size). */
+template<class Engine>
+void load(Engine& eng, std::span<const std::byte> in)
+{
+    load(eng, in.data(), in.size());
+}
+#endif
+
+/**
+ * Writes the states of the engines [first, last) to the file @c path,
+ * through a mapping of the file: the header and the engines, in the
+ * format of save(), one after the other. The file is replaced.
+ */
+template<class Engine>
+void save_engines(const char* path, const Engine* first, const Engine* last)
+{
+    namespace ipc = boost::interprocess;
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    const std::size_t size = detail::binary_state_header_size + count * detail::binary_state_engine_size<Engine>();
+    {
+        // Creates the file with its final size.
+        std::filebuf file;
+        if (!file.open(path, std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary)) {
+            throw std::runtime_error("cannot create engine checkpoint file");
+        }
+        file.pubseekoff(static_cast<std::streamoff>(size - 1), std::ios_base::beg);
+        file.sputc(0);
+    }
+    const ipc::file_mapping mapping(path, ipc::read_write);
+    ipc::mapped_region region(mapping, ipc::read_write, 0, size);
+    unsigned char* p = static_cast<unsigned char*>(region.get_address());
+    detail::write_binary_state_header<Engine>(p, count);
+    detail::binary_state_writer w = { p + detail::binary_state_header_size };
+    for (; first != last; ++first) {
+        detail::binary_state_access<Engine>::save(*first, w);
+    }
+    region.flush();
+}
+
+/**
+ * A mapped_engines maps a file written by save_engines() and restores
+ * the engines from the mapping on access, without reading the file
+ * into a buffer: the pages are read on first access, the engine i from
+ * its fixed offset.
+ *
+ * Throws std::invalid_argument if the file does not hold engines of
+ * type @c Engine.
+ */
+template<class Engine>
+class mapped_engines
+{
+public:
+    typedef Engine value_type;
+
+    explicit mapped_engines(const char* path)
+      : _mapping(path, boost::interprocess::read_only),
+        _region(_mapping, boost::interprocess::read_only)
+    {
+        _data = static_cast<const unsigned char*>(_region.get_address());
+        _size = static_cast<std::size_t>(detail::check_binary_state_header<Engine>(_data, _region.get_size()));
+        _data += detail::binary_state_header_size;
+    }
+
+    std::size_t size() const { return _size; }
+
+    /**
+     * Restores engine @c i to @c eng, throws std::invalid_argument if
+     * its state is invalid (@c eng is unchanged then).
+     */
+    void load(std::size_t i, Engine& eng) const
+    {
+        BOOST_ASSERT(i < _size);
+        detail::load_binary_state(eng, _data + i * detail::binary_state_engine_size<Engine>());
+    }
+
+    /** Returns engine @c i. */
+    Engine operator[](std::size_t i) const
+    {
+        Engine eng;
+        load(i, eng);
+        return eng;
+    }
+
+private:
+    /// \cond show_private
+
+    boost::interprocess::file_mapping _mapping;
+    boost::interprocess::mapped_region _region;
+    const unsigned char* _data;
+    std::size_t _size;
+
+    /// \endcond
+};
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_BINARY_STATE_HPP
@@ -0,0 +1,224 @@
+/* boost random/bit_stream.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_BIT_STREAM_HPP
+#define BOOST_RANDOM_BIT_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+
+#include "xoroshiro.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * The number of low bits of the output of Engine that are weaker than
+     * the other bits, as documented for the engine, and not handed out by
+     * bit_stream.
+     */
+    template<class Engine>
+    struct weak_low_bits { static const int value = 0; };
+
+#if !defined(BOOST_NO_INT64_T) && !defined(BOOST_NO_INTEGRAL_INT64_T)
+    template<> struct weak_low_bits<xoroshiro128plus> { static const int value = 1; };
+    template<> struct weak_low_bits<xoshiro256plus> { static const int value = 3; };
+    template<> struct weak_low_bits<xorshift128plus> { static const int value = 1; };
+    template<> struct weak_low_bits<xorshift1024star> { static const int value = 3; };
+#endif
+
+} // namespace detail
+
+/**
+ * A bit_stream hands out the bits of the outputs of an engine one by
+ * one, or in chunks of up to 64 bits, starting with the most significant
+ * bit of each output (the sign test of the engine documentation). The
+ * weak low bits of the engine are not used, so a xoroshiro128plus output
+ * yields 63 bits and a xoshiro256plus output 61.
+ *
+ * The bit_stream refers to the engine, which must outlive it, and holds
+ * the unused bits of the last output.
+ */
+template<class Engine>
+class bit_stream
+{
+public:
+    typedef Engine engine_type;
+
+    BOOST_STATIC_ASSERT(std::numeric_limits<typename Engine::result_type>::digits == 32 || std::numeric_limits<typename Engine::result_type>::digits == 64);
+
+    /** The number of bits taken from each output of the engine. */
+    BOOST_STATIC_CONSTANT(int, bits_per_output = std::numeric_limits<typename Engine::result_type>::digits - detail::weak_low_bits<Engine>::value);
+
+    /** Constructs a bit_stream on @c eng, with no bits buffered. */
+    explicit bit_stream(Engine& eng) : _eng(&eng), _bits(0), _count(0) { }
+
+    /** Returns the next bit. */
+    bool operator()()
+    {
+        if (!_count) {
+            refill();
+        }
+        const bool b = (_bits >> 63) != 0;
+        _bits <<= 1;
+        --_count;
+        return b;
+    }
+
+    /**
+     * Returns the next @c k bits, the first in the most significant
+     * position of the result.
+     *
+     * Requires: 1 <= k <= 64
+     */
+    std::uint64_t bits(int k)
+    {
+        BOOST_ASSERT(k >= 1 && k <= 64);
+        if (k <= _count) {
+            return take(k);
+        }
+        // The buffered bits, then bits of new outputs.
+        std::uint64_t result = shift_right(_bits, 64 - _count);
+        k -= _count;
+        while (k > bits_per_output) {
+            refill();
+            result = shift_left(result, bits_per_output) | take(bits_per_output);
+            k -= bits_per_output;
+        }
+        refill();
+        return shift_left(result, k) | take(k);
+    }
+
+    /** Returns the number of buffered bits. */
+    int available() const { return _count; }
+
+    /** Discards the buffered bits. */
+    void reset() { _bits = 0, _count = 0; }
+
+    /** Returns the engine. */
+    Engine& engine() const { return *_eng; }
+
+private:
+    /// \cond show_private
+
+    void refill()
+    {
+        // The strong bits at the top of _bits.
+        _bits = static_cast<std::uint64_t>((*_eng)()) << (64 - std::numeric_limits<typename Engine::result_type>::digits);
+        _count = bits_per_output;
+    }
+
+    static std::uint64_t shift_left(std::uint64_t x, int m)
+    {
+        return m < 64 ? x << m : 0;
+    }
+
+    static std::uint64_t shift_right(std::uint64_t x, int m)
+    {
+        return m < 64 ? x >> m : 0;
+    }
+
+    // Takes 1 <= m <= _count bits.
+    std::uint64_t take(int m)
+    {
+        const std::uint64_t r = _bits >> (64 - m);
+        _bits = shift_left(_bits, m);
+        _count -= m;
+        return r;
+    }
+
+    Engine* _eng;
+    std::uint64_t _bits;
+    int _count;
+
+    /// \endcond
+};
+
+/**
+ * Writes @c n Bernoulli(@c p) booleans to the bitmap @c out, boolean i
+ * is bit i % 64 of out[i / 64], the unused bits of the last word are
+ * cleared.
+ *
+ * 64 booleans are produced at a time, by comparing 64 uniforms in [0, 1)
+ * bit by bit with the binary expansion of @c p (to 64 bits), from the
+ * most significant bit down: a boolean is decided at the first bit that
+ * differs. That takes about 8 64-bit random words per 64 booleans, for
+ * any p.
+ *
+ * Requires: 0 <= p <= 1
+ */
+template<class Engine>
+void bernoulli_fill(bit_stream<Engine>& stream, double p, std::uint64_t* out, std::size_t n)
+{
+    BOOST_ASSERT(p >= 0.0 && p <= 1.0);
+    const std::size_t words = (n + 63) / 64;
+    const std::uint64_t last_mask = n % 64 ? (std::uint64_t { 1 } << (n % 64)) - 1 : ~std::uint64_t { 0 };
+
+    if (p <= 0.0 || p >= 1.0) {
+        const std::uint64_t fill = p >= 1.0 ? ~std::uint64_t { 0 } : 0;
+        for (std::size_t w = 0; w < words; ++w) {
+            out[w] = fill;
+        }
+        if (words) {
+            out[words - 1] &= last_mask;
+        }
+        return;
+    }
+
+    // The binary expansion of p, truncated to 64 bits.
+    const std::uint64_t expansion = static_cast<std::uint64_t>(p * 18446744073709551616.0);
+
+    for (std::size_t w = 0; w < words; ++w) {
+        std::uint64_t result = 0, undecided = ~std::uint64_t { 0 };
+        for (int k = 63; k >= 0 && undecided; --k) {
+            const std::uint64_t r = stream.bits(64);
+            if ((expansion >> k) & 1) {
+                // u_k = 0 < p_k: u < p.
+                result |= undecided & ~r;
+                undecided &= r;
+            }
+            else {
+                // u_k = 1 > p_k: u > p.
+                undecided &= ~r;
+            }
+        }
+        out[w] = result;
+    }
+    if (words) {
+        out[words - 1] &= last_mask;
+    }
+}
+
+/**
+ * Writes @c n Bernoulli(@c p) booleans to the bitmap @c out, see
+ * bernoulli_fill(bit_stream<Engine>&, p, out, n). The unused bits of the
+ * last output of @c eng are lost.
+ */
+template<class Engine>
+void bernoulli_fill(Engine& eng, double p, std::uint64_t* out, std::size_t n)
+{
+    bit_stream<Engine> stream(eng);
+    bernoulli_fill(stream, p, out, n);
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_BIT_STREAM_HPP
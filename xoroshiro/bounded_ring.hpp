@@ -0,0 +1,144 @@
+/* boost random/bounded_ring.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_BOUNDED_RING_HPP
+#define BOOST_RANDOM_BOUNDED_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/align/aligned_allocator.hpp>
+
+namespace boost {
+namespace random {
+
+/// \cond show_private
+
+namespace detail {
+
+    /**
+     * A lock-free bounded ring of blocks of @c N values of type T (Vyukov's
+     * multi-producer multi-consumer queue), used by async_random_pool and
+     * quality_monitor. push() and pop() copy a whole block in or out of a
+     * cell, they never wait: they fail if the ring is full or empty. T must
+     * be trivially copyable.
+     */
+    template<class T, std::size_t N>
+    class bounded_ring
+    {
+    public:
+        /** Constructs a ring of @c blocks blocks, rounded up to a power of 2. */
+        explicit bounded_ring(std::size_t blocks)
+          : _cells(ring_size(blocks)), _mask(_cells.size() - 1)
+        {
+            for (std::size_t i = 0; i < _cells.size(); ++i) {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            _enqueue_pos.store(0, std::memory_order_relaxed);
+            _dequeue_pos.store(0, std::memory_order_relaxed);
+        }
+
+        bounded_ring(const bounded_ring&) = delete;
+        bounded_ring& operator=(const bounded_ring&) = delete;
+
+        // Copies block into the ring, false if it is full.
+        bool push(const T* block)
+        {
+            std::size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+            cell* c;
+            for (;;) {
+                c = &_cells[pos & _mask];
+                const std::size_t sequence = c->sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(sequence - pos);
+                if (!dif) {
+                    if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (dif < 0) {
+                    return false;
+                }
+                else {
+                    pos = _enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+            std::memcpy(c->data, block, sizeof(c->data));
+            c->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Copies the oldest block of the ring to block, false if it is empty.
+        bool pop(T* block)
+        {
+            std::size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+            cell* c;
+            for (;;) {
+                c = &_cells[pos & _mask];
+                const std::size_t sequence = c->sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+                if (!dif) {
+                    if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (dif < 0) {
+                    return false;
+                }
+                else {
+                    pos = _dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+            std::memcpy(block, c->data, sizeof(c->data));
+            c->sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** Returns the number of blocks of the ring. */
+        std::size_t size() const { return _cells.size(); }
+
+    private:
+        struct cell
+        {
+            std::atomic<std::size_t> sequence;
+            BOOST_ALIGNMENT(64) T data[N];
+        };
+
+        static std::size_t ring_size(std::size_t blocks)
+        {
+            std::size_t n = 2;
+            while (n < blocks) {
+                n <<= 1;
+            }
+            return n;
+        }
+
+        std::vector<cell, boost::alignment::aligned_allocator<cell, 64> > _cells;
+        const std::size_t _mask;
+
+        // The positions written by the producers and by the consumers are
+        // on cache lines of their own.
+        BOOST_ALIGNMENT(64) std::atomic<std::size_t> _enqueue_pos;
+        BOOST_ALIGNMENT(64) std::atomic<std::size_t> _dequeue_pos;
+    };
+
+} // namespace detail
+
+/// \endcond
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_BOUNDED_RING_HPP
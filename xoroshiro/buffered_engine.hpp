@@ -0,0 +1,268 @@
+/* boost random/buffered_engine.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_BUFFERED_ENGINE_HPP
+#define BOOST_RANDOM_BUFFERED_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/random/detail/config.hpp>
+#include <boost/random/detail/seed.hpp>
+#include <boost/random/detail/seed_impl.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+#include "generate_canonical_bulk.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    // Fills out with the next n outputs of a 64-bit engine, through
+    // generate() if it is vectorized.
+    template<class Engine>
+    inline void fill_results(Engine& eng, std::uint64_t* out, std::size_t n)
+    {
+        std::size_t i = 0;
+        for (; i + canonical_block_size <= n; i += canonical_block_size) {
+            canonical_bits(eng, out + i, canonical_block_size, canonical_by_generate<Engine>());
+        }
+        if (i < n) {
+            canonical_bits(eng, out + i, n - i, canonical_by_generate<Engine>());
+        }
+    }
+
+    // Fills out with the next n outputs of a 32-bit engine.
+    template<class Engine>
+    inline void fill_results(Engine& eng, std::uint32_t* out, std::size_t n)
+    {
+        canonical_words(eng, out, n, canonical_by_generate<Engine>());
+    }
+
+} // namespace detail
+
+/**
+ * Instantiations of class template buffered_engine model a
+ * \pseudo_random_number_generator. A buffered_engine produces the
+ * sequence of the underlying engine, from a buffer of @c BlockBytes bytes
+ * that is refilled in one go when exhausted: through the vectorized
+ * generate() of engines that have one (splitmix64, taus88, lfsr113) and
+ * otherwise with a tight loop over the engine, whose state then stays in
+ * registers.
+ *
+ * operator() has a single branch, taken once per block, the refill is not
+ * inlined. The buffer is aligned on a cache line.
+ *
+ * A buffered_engine is not faster than its engine in a loop that does
+ * nothing but draw values, the load from the buffer and the branch cost
+ * more than a step of these engines. main_buffered_engine (500'000'000
+ * draws, ms):
+ *
+ *   engine             raw   64 B   512 B   4096 B
+ *   splitmix64         468   1605     937      983
+ *   xoroshiro128plus   729    959    1030     1058
+ *
+ * It is meant for call sites where the engine cannot stay in registers
+ * between the draws (f.e. draws interleaved with other work that spills
+ * it), measure it there before using it. 64 byte blocks refill too often,
+ * the default is 512 bytes.
+ *
+ * BlockBytes must be a multiple of the size of the result_type of
+ * Engine, from one cache line up to several KB.
+ */
+template<class Engine, std::size_t BlockBytes = 512>
+class buffered_engine
+{
+    typedef typename detail::seed_type<typename Engine::result_type>::type seed_type;
+public:
+    typedef Engine base_type;
+    typedef typename base_type::result_type result_type;
+
+    BOOST_STATIC_ASSERT(std::numeric_limits<result_type>::digits == 32 || std::numeric_limits<result_type>::digits == 64);
+    BOOST_STATIC_ASSERT(BlockBytes >= 64 && BlockBytes % sizeof(result_type) == 0);
+
+    /** The number of values in a block. */
+    BOOST_STATIC_CONSTANT(std::size_t, block_size = BlockBytes / sizeof(result_type));
+
+    BOOST_STATIC_CONSTANT(bool, has_fixed_range = false);
+
+    /** Uses the default seed for the base generator. */
+    buffered_engine() : _rng(), _index(block_size) { }
+    /** Constructs a new \buffered_engine with a copy of rng. */
+    explicit buffered_engine(const base_type& rng) : _rng(rng), _index(block_size) { }
+
+    /**
+     * Creates a new \buffered_engine and seeds the underlying
+     * generator with @c value
+     */
+    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(buffered_engine, seed_type, value)
+    { _rng.seed(value); _index = block_size; }
+
+    /**
+     * Creates a new \buffered_engine and seeds the underlying
+     * generator with @c seq
+     */
+    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(buffered_engine, SeedSeq, seq)
+    { _rng.seed(seq); _index = block_size; }
+
+    /**
+     * Creates a new \buffered_engine and seeds the underlying
+     * generator with first and last.
+     */
+    template<class It> buffered_engine(It& first, It last)
+      : _rng(first, last), _index(block_size) { }
+
+    /** default seeds the underlying generator. */
+    void seed() { _rng.seed(); _index = block_size; }
+    /** Seeds the underlying generator with s. */
+    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(buffered_engine, seed_type, s)
+    { _rng.seed(s); _index = block_size; }
+    /** Seeds the underlying generator with seq. */
+    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(buffered_engine, SeedSeq, seq)
+    { _rng.seed(seq); _index = block_size; }
+    /** Seeds the underlying generator with first and last. */
+    template<class It> void seed(It& first, It last)
+    { _rng.seed(first, last); _index = block_size; }
+
+    /**
+     * Returns the underlying engine, which is ahead of this engine by the
+     * buffered values.
+     */
+    const base_type& base() const { return _rng; }
+
+    /** Returns the next value of the generator. */
+    result_type operator()()
+    {
+        if (BOOST_UNLIKELY(_index == block_size)) {
+            refill();
+        }
+        return _data[_index++];
+    }
+
+    /** Advances the state of the generator by @c z. */
+    void discard(boost::uintmax_t z)
+    {
+        const std::size_t available = block_size - _index;
+        if (z <= available) {
+            _index += static_cast<std::size_t>(z);
+            return;
+        }
+        _rng.discard(z - available);
+        _index = block_size;
+    }
+
+    /** Fills a range with random values. */
+    template<class It>
+    void generate(It first, It last)
+    { detail::generate_from_int(*this, first, last); }
+
+    /**
+     * Returns the smallest value that the generator can produce.
+     * This is the same as the minimum of the underlying generator.
+     */
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (base_type::min)(); }
+    /**
+     * Returns the largest value that the generator can produce.
+     * This is the same as the maximum of the underlying generator.
+     */
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (base_type::max)(); }
+
+#ifndef BOOST_RANDOM_NO_STREAM_OPERATORS
+    /**
+     * Writes a \buffered_engine to a @c std::ostream, the underlying
+     * generator followed by the buffered values.
+     */
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT,Traits>&
+    operator<<(std::basic_ostream<CharT,Traits>& os, const buffered_engine& s)
+    {
+        os << s._rng << ' ' << (block_size - s._index);
+        for (std::size_t i = s._index; i < block_size; ++i) {
+            os << ' ' << s._data[i];
+        }
+        return os;
+    }
+
+    /** Reads a \buffered_engine from a @c std::istream. */
+    template<class CharT, class Traits>
+    friend std::basic_istream<CharT,Traits>&
+    operator>>(std::basic_istream<CharT,Traits>& is, buffered_engine& s)
+    {
+        std::size_t available = 0;
+        is >> s._rng >> std::ws >> available;
+        if (available > block_size) {
+            is.setstate(std::ios_base::failbit);
+            return is;
+        }
+        s._index = block_size - available;
+        for (std::size_t i = s._index; i < block_size; ++i) {
+            is >> std::ws >> s._data[i];
+        }
+        return is;
+    }
+#endif
+
+    /** Returns true if the two generators will produce identical sequences. */
+    friend bool operator==(const buffered_engine& x, const buffered_engine& y)
+    {
+        if (x._rng != y._rng || x._index != y._index) {
+            return false;
+        }
+        for (std::size_t i = x._index; i < block_size; ++i) {
+            if (x._data[i] != y._data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /** Returns true if the two generators will produce different sequences. */
+    friend bool operator!=(const buffered_engine& x, const buffered_engine& y)
+    { return !(x == y); }
+
+private:
+    /// \cond show_private
+
+    BOOST_NOINLINE void refill()
+    {
+        detail::fill_results(_rng, _data, block_size);
+        _index = 0;
+    }
+
+    BOOST_ALIGNMENT(64) result_type _data[block_size];
+    base_type _rng;
+    std::size_t _index;
+
+    /// \endcond
+};
+
+#ifndef BOOST_NO_INCLASS_MEMBER_INITIALIZATION
+//  A definition is required even for integral static constants
+template<class Engine, std::size_t BlockBytes>
+const std::size_t buffered_engine<Engine, BlockBytes>::block_size;
+template<class Engine, std::size_t BlockBytes>
+const bool buffered_engine<Engine, BlockBytes>::has_fixed_range;
+#endif
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_BUFFERED_ENGINE_HPP
@@ -6,6 +6,7 @@
 #include <ostream>
 #include <stdexcept>
 #include <vector>
+#include <string>
 #include <iterator>
 #include <algorithm>
 #include <type_traits>
@@ -24,6 +25,32 @@ namespace random {
 
 #if !defined(BOOST_NO_INT64_T) && !defined(BOOST_NO_INTEGRAL_INT64_T)
 
+namespace detail {
+
+	/**
+	* A SeedSeq producing the stream of a splitmix64 seeded with @c key, as
+	* generator_seed_seq<splitmix64> does, but through splitmix64::at(): the
+	* seeding of a cmwc engine does not count as use of a splitmix64.
+	*/
+	class splitmix64_seed_seq {
+	public:
+		explicit splitmix64_seed_seq(std::uint64_t key) : _key(key), _index(0) { }
+
+		template<class It>
+		void generate(It first, It last)
+		{
+			for (; first != last; ++first) {
+				*first = boost::random::splitmix64::at(_key, _index++);
+			}
+		}
+
+	private:
+		std::uint64_t _key;
+		std::uint64_t _index;
+	};
+
+} // namespace detail
+
 template<typename IntType, std::size_t w, std::size_t CMWC_CYCLE, std::uint32_t CMWC_C_MAX, std::uint64_t A, bool is_complementary>
 class complementary_multiply_with_carry_engine {
 	typedef typename std::conditional<is_complementary, std::true_type, std::false_type>::type complementary;
@@ -94,8 +121,7 @@ public:
 	{
 		BOOST_STATIC_ASSERT(std::numeric_limits<IT>::is_integer);
 
-		boost::random::splitmix64 intgen(static_cast<std::uint64_t>(value));
-		detail::generator_seed_seq<boost::random::splitmix64> gen(intgen);
+		detail::splitmix64_seed_seq gen(static_cast<std::uint64_t>(value));
 		seed(gen);
 	}
 
@@ -104,6 +130,7 @@ public:
 	*/
 	BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(complementary_multiply_with_carry_engine, SeedSeq, seq)
 	{
+		BOOST_RANDOM_DETAIL_INSTRUMENT(complementary_multiply_with_carry_engine, reseeds, 1);
 		detail::seed_array_int<w>(seq, _Q);
 		_carry = detail::seed_one_int<IntType, CMWC_C_MAX>(seq);
 		_i = CMWC_CYCLE - 1;
@@ -122,6 +149,7 @@ public:
 	template<class It>
 	void seed(It& first, It last)
 	{
+		BOOST_RANDOM_DETAIL_INSTRUMENT(complementary_multiply_with_carry_engine, reseeds, 1);
 		detail::fill_array_int<w>(first, last, _Q );
 		_carry = detail::seed_one_int<IntType, CMWC_C_MAX>(first, last);
 		_i = CMWC_CYCLE - 1;
@@ -152,6 +180,7 @@ public:
 			std::is_same<U, std::true_type>::value, result_type>::type
 	operator()( )
 	{
+		BOOST_RANDOM_DETAIL_INSTRUMENT(complementary_multiply_with_carry_engine, values, 1);
 		_i = (_i + 1) & (CMWC_CYCLE - 1);
 		const std::uint64_t t = A * _Q[_i] + _carry;
 		_carry = t >> 32;
@@ -172,6 +201,7 @@ public:
 			std::is_same<U, std::false_type>::value, result_type>::type
 	operator()( )
 	{
+		BOOST_RANDOM_DETAIL_INSTRUMENT(complementary_multiply_with_carry_engine, values, 1);
 		_i = (_i + 1) & (CMWC_CYCLE - 1);
 		const std::uint64_t t = A * _Q[_i] + _carry;
 		_carry = t >> 32;
@@ -186,6 +216,7 @@ public:
 	template<class Iter>
 	void generate(Iter first, Iter last)
 	{
+		BOOST_RANDOM_DETAIL_INSTRUMENT(complementary_multiply_with_carry_engine, bulk_calls, 1);
 		detail::generate_from_int(*this, first, last);
 	}
 
@@ -234,6 +265,20 @@ public:
 
 private:
 
+	template<class Engine>
+	friend struct detail::binary_state_access;
+	BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(complementary_multiply_with_carry_engine, instrumented_name())
+
+#if defined(BOOST_RANDOM_INSTRUMENTATION)
+	static const char* instrumented_name()
+	{
+		static const std::string name = "complementary_multiply_with_carry_engine<" + std::to_string(w) + ","
+			+ std::to_string(CMWC_CYCLE) + "," + std::to_string(CMWC_C_MAX) + "," + std::to_string(A) + ","
+			+ std::to_string(is_complementary) + ">";
+		return name.c_str();
+	}
+#endif
+
 	// As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
 	inline void warmup()
 	{
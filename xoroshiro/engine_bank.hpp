@@ -0,0 +1,332 @@
+/* boost random/engine_bank.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_ENGINE_BANK_HPP
+#define BOOST_RANDOM_ENGINE_BANK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/align/aligned_allocator.hpp>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "xoroshiro.hpp"
+#include "seed_many.hpp"
+#include "uniform_bounded.hpp"
+
+namespace boost {
+namespace random {
+
+#if !defined(BOOST_NO_INT64_T) && !defined(BOOST_NO_INTEGRAL_INT64_T)
+
+namespace detail {
+
+    // The operations of the xoroshiro128 step and scramblers, on one
+    // engine or on a register of engines, one per 64-bit lane.
+
+    inline std::uint64_t bank_add(std::uint64_t a, std::uint64_t b) { return a + b; }
+    inline std::uint64_t bank_xor(std::uint64_t a, std::uint64_t b) { return a ^ b; }
+    template<int k> inline std::uint64_t bank_shl(std::uint64_t a) { return a << k; }
+    template<int k> inline std::uint64_t bank_shr(std::uint64_t a) { return a >> k; }
+    template<int k> inline std::uint64_t bank_rotl(std::uint64_t a) { return (a << k) | (a >> (64 - k)); }
+    inline std::uint64_t bank_mul(std::uint64_t a, std::uint64_t c) { return a * c; }
+
+#if defined(__AVX2__)
+    inline __m256i bank_add(__m256i a, __m256i b) { return _mm256_add_epi64(a, b); }
+    inline __m256i bank_xor(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+    template<int k> inline __m256i bank_shl(__m256i a) { return _mm256_slli_epi64(a, k); }
+    template<int k> inline __m256i bank_shr(__m256i a) { return _mm256_srli_epi64(a, k); }
+    template<int k> inline __m256i bank_rotl(__m256i a)
+    { return _mm256_or_si256(_mm256_slli_epi64(a, k), _mm256_srli_epi64(a, 64 - k)); }
+    // The low 64 bits of a * c, from three 32 x 32 bit products.
+    inline __m256i bank_mul(__m256i a, std::uint64_t c)
+    {
+        const __m256i lo = _mm256_set1_epi64x(static_cast<long long>(c & 0xFFFFFFFF));
+        const __m256i hi = _mm256_set1_epi64x(static_cast<long long>(c >> 32));
+        const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), lo), _mm256_mul_epu32(a, hi));
+        return _mm256_add_epi64(_mm256_mul_epu32(a, lo), _mm256_slli_epi64(cross, 32));
+    }
+#endif
+
+#if defined(__AVX512F__)
+    inline __m512i bank_add(__m512i a, __m512i b) { return _mm512_add_epi64(a, b); }
+    inline __m512i bank_xor(__m512i a, __m512i b) { return _mm512_xor_si512(a, b); }
+    template<int k> inline __m512i bank_shl(__m512i a) { return _mm512_slli_epi64(a, k); }
+    template<int k> inline __m512i bank_shr(__m512i a) { return _mm512_srli_epi64(a, k); }
+    template<int k> inline __m512i bank_rotl(__m512i a) { return _mm512_rol_epi64(a, k); }
+    inline __m512i bank_mul(__m512i a, std::uint64_t c)
+    {
+#if defined(__AVX512DQ__)
+        return _mm512_mullo_epi64(a, _mm512_set1_epi64(static_cast<long long>(c)));
+#else
+        const __m512i lo = _mm512_set1_epi64(static_cast<long long>(c & 0xFFFFFFFF));
+        const __m512i hi = _mm512_set1_epi64(static_cast<long long>(c >> 32));
+        const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(a, 32), lo), _mm512_mul_epu32(a, hi));
+        return _mm512_add_epi64(_mm512_mul_epu32(a, lo), _mm512_slli_epi64(cross, 32));
+#endif
+    }
+#endif
+
+    // The state transition of the xoroshiro128 engines.
+    template<class V>
+    inline void xoroshiro128_step(V& s0, V& s1)
+    {
+        s1 = bank_xor(s1, s0);
+        s0 = bank_xor(bank_xor(bank_rotl<55>(s0), s1), bank_shl<14>(s1));
+        s1 = bank_rotl<36>(s1);
+    }
+
+    template<class V>
+    inline V xorshift32(V r) { return bank_xor(r, bank_shr<32>(r)); }
+
+    /** The output function of each engine of the xoroshiro128 family. */
+    template<class Engine>
+    struct xoroshiro128_scrambler;
+
+    template<>
+    struct xoroshiro128_scrambler<xoroshiro128plus>
+    {
+        template<class V>
+        static V apply(V s0, V s1) { return bank_add(s0, s1); }
+    };
+
+    template<>
+    struct xoroshiro128_scrambler<xoroshiro128plusshixo>
+    {
+        template<class V>
+        static V apply(V s0, V s1) { return xorshift32(bank_add(s0, s1)); }
+    };
+
+    template<>
+    struct xoroshiro128_scrambler<xoroshiro128plusshixostar>
+    {
+        template<class V>
+        static V apply(V s0, V s1)
+        { return bank_mul(xorshift32(bank_add(s0, s1)), std::uint64_t { 0x1AEC805299990163 }); }
+    };
+
+    template<>
+    struct xoroshiro128_scrambler<xoroshiro128plusshixostarshixo>
+    {
+        template<class V>
+        static V apply(V s0, V s1)
+        { return xorshift32(bank_mul(xorshift32(bank_add(s0, s1)), std::uint64_t { 0x1AEC805299990163 })); }
+    };
+
+} // namespace detail
+
+/**
+ * An engine_bank holds @c n engines of the xoroshiro128 family
+ * (xoroshiro128plus, xoroshiro128plusshixo, xoroshiro128plusshixostar or
+ * xoroshiro128plusshixostarshixo) as a structure of arrays: the first
+ * state words of all engines in one 64-byte aligned array, the second in
+ * another. Engine i of the bank produces the sequence of the Engine with
+ * state (s0[i], s1[i]).
+ *
+ * generate() and discard() advance all engines by one step in a
+ * streaming pass over the two arrays, 8 engines per step with AVX-512, 4
+ * with AVX2. The indexed generate() advances the engines of an index
+ * list, gathering and scattering their states.
+ *
+ * The number of engines must be less than 2^32.
+ */
+template<class Engine>
+class engine_bank
+{
+    typedef detail::xoroshiro128_scrambler<Engine> scrambler;
+    typedef std::vector<std::uint64_t, boost::alignment::aligned_allocator<std::uint64_t, 64> > array_type;
+public:
+    typedef Engine engine_type;
+    typedef std::uint64_t result_type;
+
+    /** Constructs an empty bank. */
+    engine_bank() { }
+
+    /**
+     * Constructs a bank of @c n engines seeded from @c seq, the engines
+     * are those of seed_many(seq, first, first + n).
+     */
+    template<class SeedSeq>
+    engine_bank(std::size_t n, SeedSeq& seq) : _s0(n), _s1(n)
+    { seed(seq); }
+
+    /** Constructs a bank of copies of the engines [first, last). */
+    engine_bank(const Engine* first, const Engine* last)
+      : _s0(static_cast<std::size_t>(last - first)), _s1(static_cast<std::size_t>(last - first))
+    {
+        for (std::size_t i = 0; i < _s0.size(); ++i) {
+            set(i, first[i]);
+        }
+    }
+
+    /** Seeds the engines from @c seq, see seed_many(). */
+    template<class SeedSeq>
+    void seed(SeedSeq& seq)
+    {
+        const put_lanes put = { _s0.data(), _s1.data() };
+        detail::seed_many_states(seq, 2, size(), put);
+        // The warmup of the engines.
+        for (int step = 0; step < 8; ++step) {
+            discard();
+        }
+    }
+
+    /** Returns the number of engines. */
+    std::size_t size() const { return _s0.size(); }
+
+    /** Returns a copy of engine @c i. */
+    Engine get(std::size_t i) const
+    { return detail::engine_access<Engine>::make(_s0[i], _s1[i]); }
+
+    /** Sets engine @c i to @c eng. */
+    void set(std::size_t i, const Engine& eng)
+    {
+        Engine copy(eng);
+        const std::uint64_t* s = detail::engine_access<Engine>::state(copy);
+        _s0[i] = s[0], _s1[i] = s[1];
+    }
+
+    /** Writes the next value of each engine to @c out[i]. */
+    void generate(std::uint64_t* out) { pass<true>(out); }
+
+    /** Advances each engine by one step. */
+    void discard() { pass<false>(0); }
+
+    /**
+     * Writes the next value of engine @c indices[k] to @c out[k], for k
+     * in [0, m). The indices are distinct.
+     */
+    void generate(const std::uint32_t* indices, std::size_t m, std::uint64_t* out)
+    {
+        std::uint64_t* s0 = _s0.data();
+        std::uint64_t* s1 = _s1.data();
+        // The states of an engine are on two cache lines, the states of
+        // the engines a distance ahead are prefetched.
+        const std::size_t distance = 32;
+        for (std::size_t k = 0; k < m && k < distance; ++k) {
+            detail::prefetch(s0 + indices[k]), detail::prefetch(s1 + indices[k]);
+        }
+        std::size_t k = 0;
+#if defined(__AVX512F__)
+        for (; k + 8 <= m; k += 8) {
+            for (std::size_t l = k + distance; l < k + distance + 8 && l < m; ++l) {
+                detail::prefetch(s0 + indices[l]), detail::prefetch(s1 + indices[l]);
+            }
+            const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + k));
+            __m512i v0 = _mm512_i32gather_epi64(index, s0, 8);
+            __m512i v1 = _mm512_i32gather_epi64(index, s1, 8);
+            _mm512_storeu_si512(out + k, scrambler::apply(v0, v1));
+            detail::xoroshiro128_step(v0, v1);
+            _mm512_i32scatter_epi64(s0, index, v0, 8);
+            _mm512_i32scatter_epi64(s1, index, v1, 8);
+        }
+#elif defined(__AVX2__)
+        for (; k + 4 <= m; k += 4) {
+            for (std::size_t l = k + distance; l < k + distance + 4 && l < m; ++l) {
+                detail::prefetch(s0 + indices[l]), detail::prefetch(s1 + indices[l]);
+            }
+            const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + k));
+            __m256i v0 = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(s0), index, 8);
+            __m256i v1 = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(s1), index, 8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), scrambler::apply(v0, v1));
+            detail::xoroshiro128_step(v0, v1);
+            // AVX2 has no scatter.
+            BOOST_ALIGNMENT(32) std::uint64_t t0[4], t1[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(t0), v0);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(t1), v1);
+            for (std::size_t l = 0; l < 4; ++l) {
+                s0[indices[k + l]] = t0[l], s1[indices[k + l]] = t1[l];
+            }
+        }
+#endif
+        for (; k < m; ++k) {
+            if (k + distance < m) {
+                detail::prefetch(s0 + indices[k + distance]), detail::prefetch(s1 + indices[k + distance]);
+            }
+            const std::uint32_t i = indices[k];
+            out[k] = scrambler::apply(s0[i], s1[i]);
+            detail::xoroshiro128_step(s0[i], s1[i]);
+        }
+    }
+
+    /** Returns the first state words of the engines. */
+    const std::uint64_t* s0() const { return _s0.data(); }
+    /** Returns the second state words of the engines. */
+    const std::uint64_t* s1() const { return _s1.data(); }
+
+private:
+    /// \cond show_private
+
+    // Stores the states of detail::seed_many_states() in the lanes.
+    struct put_lanes
+    {
+        std::uint64_t* s0;
+        std::uint64_t* s1;
+
+        void operator()(std::size_t i, const std::uint64_t* s) const
+        { s0[i] = s[0], s1[i] = s[1]; }
+    };
+
+    template<bool Output>
+    void pass(std::uint64_t* out)
+    {
+        const std::size_t n = size();
+        std::uint64_t* s0 = _s0.data();
+        std::uint64_t* s1 = _s1.data();
+        std::size_t i = 0;
+#if defined(__AVX512F__)
+        for (; i + 8 <= n; i += 8) {
+            __m512i v0 = _mm512_load_si512(s0 + i), v1 = _mm512_load_si512(s1 + i);
+            if (Output) {
+                _mm512_storeu_si512(out + i, scrambler::apply(v0, v1));
+            }
+            detail::xoroshiro128_step(v0, v1);
+            _mm512_store_si512(s0 + i, v0), _mm512_store_si512(s1 + i, v1);
+        }
+#elif defined(__AVX2__)
+        for (; i + 4 <= n; i += 4) {
+            __m256i v0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(s0 + i));
+            __m256i v1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(s1 + i));
+            if (Output) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), scrambler::apply(v0, v1));
+            }
+            detail::xoroshiro128_step(v0, v1);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(s0 + i), v0);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(s1 + i), v1);
+        }
+#endif
+        for (; i < n; ++i) {
+            if (Output) {
+                out[i] = scrambler::apply(s0[i], s1[i]);
+            }
+            detail::xoroshiro128_step(s0[i], s1[i]);
+        }
+    }
+
+    array_type _s0, _s1;
+
+    /// \endcond
+};
+
+#endif /* !BOOST_NO_INT64_T && !BOOST_NO_INTEGRAL_INT64_T */
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_ENGINE_BANK_HPP
@@ -0,0 +1,363 @@
+/* boost random/engine_view.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_ENGINE_VIEW_HPP
+#define BOOST_RANDOM_ENGINE_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_ranges) && defined(__cpp_lib_span)
+#include <ranges>
+#include <span>
+#endif
+
+#if defined(__cpp_lib_coroutine)
+#include <coroutine>
+#include <exception>
+#endif
+
+#include <boost/config.hpp>
+
+#include "buffered_engine.hpp"
+
+namespace boost {
+namespace random {
+
+#if defined(__cpp_lib_ranges) && defined(__cpp_lib_span)
+
+namespace detail {
+
+    /**
+     * The block of an engine view, refilled through the bulk path of
+     * buffered_engine. The view refers to the engine, which must outlive
+     * it.
+     */
+    template<class Engine, std::size_t BlockBytes>
+    class engine_view_block
+    {
+    public:
+        typedef typename Engine::result_type result_type;
+
+        static constexpr std::size_t block_size = BlockBytes / sizeof(result_type);
+
+        static_assert(BlockBytes >= 64 && BlockBytes % sizeof(result_type) == 0);
+
+        engine_view_block() = default;
+        explicit engine_view_block(Engine& eng) : _eng(std::addressof(eng)) { }
+
+    protected:
+        void refill() { fill_results(*_eng, _data, block_size); }
+
+        Engine* _eng = nullptr;
+        alignas(64) result_type _data[block_size];
+    };
+
+} // namespace detail
+
+/**
+ * An engine_view is an infinite std::ranges::input_range over the
+ * outputs of an engine: the values of successive calls of @c eng(),
+ * produced a block of @c BlockBytes bytes at a time (the vectorized
+ * generate() of the engine, where it has one). The engine is advanced by
+ * whole blocks, ahead of the values read.
+ *
+ * The position is held by the iterator, which refers to the view for the
+ * refills: begin() is called once (as for a generator), and the view is
+ * not moved while the iterator is in use.
+ */
+template<class Engine, std::size_t BlockBytes = 4096>
+class engine_view
+  : public std::ranges::view_interface<engine_view<Engine, BlockBytes> >,
+    private detail::engine_view_block<Engine, BlockBytes>
+{
+    typedef detail::engine_view_block<Engine, BlockBytes> base_type;
+public:
+    typedef typename base_type::result_type result_type;
+
+    using base_type::block_size;
+
+    class iterator
+    {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = result_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        result_type operator*() const { return *_next; }
+
+        iterator& operator++()
+        {
+            if (BOOST_UNLIKELY(++_next == _view->_data + block_size)) {
+                _view->refill();
+                _next = _view->_data;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator&, std::unreachable_sentinel_t) noexcept { return false; }
+
+    private:
+        friend class engine_view;
+        explicit iterator(engine_view* view) : _view(view), _next(view->_data) { }
+
+        engine_view* _view = nullptr;
+        const result_type* _next = nullptr;
+    };
+
+    engine_view() = default;
+    /** Creates a view on @c eng, nothing is drawn until begin(). */
+    explicit engine_view(Engine& eng) : base_type(eng) { }
+
+    /** Draws the first block. */
+    iterator begin()
+    {
+        this->refill();
+        return iterator(this);
+    }
+    std::unreachable_sentinel_t end() const noexcept { return {}; }
+};
+
+/**
+ * An engine_block_view is an infinite std::ranges::input_range of blocks
+ * of the outputs of an engine, each a std::span of block_size contiguous
+ * values. A std::views::transform (or a plain loop) over a block is a
+ * loop over an array that the compiler can vectorize, and
+ * std::views::join flattens the blocks to the values of engine_view.
+ *
+ * A block is overwritten when the iterator is incremented, begin() is
+ * called once.
+ */
+template<class Engine, std::size_t BlockBytes = 4096>
+class engine_block_view
+  : public std::ranges::view_interface<engine_block_view<Engine, BlockBytes> >,
+    private detail::engine_view_block<Engine, BlockBytes>
+{
+    typedef detail::engine_view_block<Engine, BlockBytes> base_type;
+public:
+    typedef typename base_type::result_type result_type;
+    typedef std::span<const result_type, base_type::block_size> block_type;
+
+    using base_type::block_size;
+
+    class iterator
+    {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = block_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        block_type operator*() const { return block_type(_view->_data); }
+
+        iterator& operator++()
+        {
+            _view->refill();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator&, std::unreachable_sentinel_t) noexcept { return false; }
+
+    private:
+        friend class engine_block_view;
+        explicit iterator(engine_block_view* view) : _view(view) { }
+
+        engine_block_view* _view = nullptr;
+    };
+
+    engine_block_view() = default;
+    /** Creates a view on @c eng, nothing is drawn until begin(). */
+    explicit engine_block_view(Engine& eng) : base_type(eng) { }
+
+    /** Draws the first block. */
+    iterator begin()
+    {
+        this->refill();
+        return iterator(this);
+    }
+    std::unreachable_sentinel_t end() const noexcept { return {}; }
+};
+
+#endif /* __cpp_lib_ranges && __cpp_lib_span */
+
+#if defined(__cpp_lib_coroutine)
+
+/**
+ * A coroutine_generator<T> is the result of a coroutine that yields
+ * values of type T, an input range of those values. It is move-only and
+ * destroys the coroutine.
+ */
+template<class T>
+class coroutine_generator
+#if defined(__cpp_lib_ranges)
+  : public std::ranges::view_interface<coroutine_generator<T> >
+#endif
+{
+public:
+    struct promise_type
+    {
+        coroutine_generator get_return_object() noexcept
+        { return coroutine_generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        // The yielded value lives until the coroutine is resumed.
+        std::suspend_always yield_value(const T& value) noexcept
+        {
+            _value = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept { }
+        void unhandled_exception() { _exception = std::current_exception(); }
+
+        const T* _value = nullptr;
+        std::exception_ptr _exception;
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    class iterator
+    {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        const T& operator*() const { return *_handle.promise()._value; }
+
+        iterator& operator++()
+        {
+            _handle.resume();
+            rethrow();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+        { return !it._handle || it._handle.done(); }
+
+    private:
+        friend class coroutine_generator;
+        explicit iterator(handle_type handle) : _handle(handle) { }
+
+        void rethrow() const
+        {
+            if (_handle.promise()._exception) {
+                std::rethrow_exception(std::exchange(_handle.promise()._exception, nullptr));
+            }
+        }
+
+        handle_type _handle;
+    };
+
+    coroutine_generator() = default;
+    coroutine_generator(coroutine_generator&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) { }
+    coroutine_generator& operator=(coroutine_generator&& other) noexcept
+    {
+        if (this != &other) {
+            if (_handle) {
+                _handle.destroy();
+            }
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+    ~coroutine_generator()
+    {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    /** Runs the coroutine to its first value. */
+    iterator begin()
+    {
+        iterator it(_handle);
+        if (_handle && !_handle.done()) {
+            _handle.resume();
+            it.rethrow();
+        }
+        return it;
+    }
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    explicit coroutine_generator(handle_type handle) : _handle(handle) { }
+
+    handle_type _handle;
+};
+
+/**
+ * Returns an infinite coroutine_generator of the outputs of @c eng,
+ * which draws them a block of @c BlockBytes bytes at a time, as
+ * engine_view. The engine must outlive the generator.
+ */
+template<class Engine, std::size_t BlockBytes = 4096>
+coroutine_generator<typename Engine::result_type> generate_values(Engine& eng)
+{
+    typedef typename Engine::result_type result_type;
+    constexpr std::size_t block_size = BlockBytes / sizeof(result_type);
+    static_assert(BlockBytes >= 64 && BlockBytes % sizeof(result_type) == 0);
+
+    result_type block[block_size];
+    for (;;) {
+        detail::fill_results(eng, block, block_size);
+        for (std::size_t i = 0; i < block_size; ++i) {
+            co_yield block[i];
+        }
+    }
+}
+
+#if defined(__cpp_lib_span)
+/**
+ * Returns an infinite coroutine_generator of blocks of the outputs of
+ * @c eng, as engine_block_view. A block is overwritten when the
+ * coroutine is resumed.
+ */
+template<class Engine, std::size_t BlockBytes = 4096>
+coroutine_generator<std::span<const typename Engine::result_type, BlockBytes / sizeof(typename Engine::result_type)> > generate_blocks(Engine& eng)
+{
+    typedef typename Engine::result_type result_type;
+    constexpr std::size_t block_size = BlockBytes / sizeof(result_type);
+    static_assert(BlockBytes >= 64 && BlockBytes % sizeof(result_type) == 0);
+
+    result_type block[block_size];
+    for (;;) {
+        detail::fill_results(eng, block, block_size);
+        co_yield std::span<const result_type, block_size>(block, block_size);
+    }
+}
+#endif
+
+#endif /* __cpp_lib_coroutine */
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_ENGINE_VIEW_HPP
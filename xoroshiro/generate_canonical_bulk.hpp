@@ -0,0 +1,210 @@
+/* boost random/generate_canonical_bulk.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_GENERATE_CANONICAL_BULK_HPP
+#define BOOST_RANDOM_GENERATE_CANONICAL_BULK_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "xoroshiro.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * Whether Engine::generate() is the fastest way to obtain raw bits from
+     * Engine, i.e. it is vectorized or the engine produces 32-bit values.
+     * Otherwise the bits are obtained with operator().
+     */
+    template<class Engine>
+    struct canonical_by_generate
+        : boost::integral_constant<bool, std::numeric_limits<typename Engine::result_type>::digits == 32> { };
+
+#if !defined(BOOST_NO_INT64_T) && !defined(BOOST_NO_INTEGRAL_INT64_T)
+    template<>
+    struct canonical_by_generate<splitmix64> : boost::true_type { };
+#endif
+
+    // The block size, in 64-bit values.
+    const std::size_t canonical_block_size = 256;
+
+    // Fills bits with n 64-bit values, either 64-bit outputs of eng or
+    // pairs of 32-bit outputs (the first output in the low word).
+    template<class Engine>
+    inline void canonical_bits(Engine& eng, std::uint64_t* bits, std::size_t n, boost::true_type)
+    {
+        std::uint32_t words[2 * canonical_block_size];
+        eng.generate(words, words + 2 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            bits[i] = static_cast<std::uint64_t>(words[2 * i])
+                | static_cast<std::uint64_t>(words[2 * i + 1]) << 32;
+        }
+    }
+
+    template<class Engine>
+    inline void canonical_bits(Engine& eng, std::uint64_t* bits, std::size_t n, boost::false_type)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            bits[i] = static_cast<std::uint64_t>(eng());
+        }
+    }
+
+    // Fills words with n 32-bit values, either 32-bit outputs of eng or
+    // the words of 64-bit outputs (the low word first).
+    template<class Engine>
+    inline void canonical_words(Engine& eng, std::uint32_t* words, std::size_t n, boost::true_type)
+    {
+        eng.generate(words, words + n);
+    }
+
+    template<class Engine>
+    inline void canonical_words(Engine& eng, std::uint32_t* words, std::size_t n, boost::false_type)
+    {
+        for (std::size_t i = 0; i < n; i += 2) {
+            const std::uint64_t v = static_cast<std::uint64_t>(eng());
+            words[i] = static_cast<std::uint32_t>(v);
+            if (i + 1 < n) {
+                words[i + 1] = static_cast<std::uint32_t>(v >> 32);
+            }
+        }
+    }
+
+    // The canonical doubles (bits >> 11) * 2^-53.
+    inline void canonical_convert(const std::uint64_t* bits, double* out, std::size_t n)
+    {
+        const double scale = 1.0 / static_cast<double>(std::uint64_t { 1 } << 53);
+        std::size_t i = 0;
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+        const __m512d scale8 = _mm512_set1_pd(scale);
+        for (; i + 8 <= n; i += 8) {
+            const __m512i x = _mm512_srli_epi64(_mm512_loadu_si512(bits + i), 11);
+            _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_cvtepu64_pd(x), scale8));
+        }
+#elif defined(__AVX2__)
+        // No 64-bit integer to double conversion in AVX2, the 53 bits are
+        // converted exactly as 2^84 + hi * 2^32 - 2^84 plus 2^52 + lo - 2^52.
+        const __m256i exp_hi = _mm256_set1_epi64x(0x4530000000000000);
+        const __m256i exp_lo = _mm256_set1_epi64x(0x4330000000000000);
+        const __m256d bias_hi = _mm256_set1_pd(19342813113834066795298816.0); // 2^84
+        const __m256d bias_lo = _mm256_set1_pd(4503599627370496.0);           // 2^52
+        const __m256d scale4 = _mm256_set1_pd(scale);
+        for (; i + 4 <= n; i += 4) {
+            const __m256i x = _mm256_srli_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + i)), 11);
+            const __m256i hi = _mm256_or_si256(_mm256_srli_epi64(x, 32), exp_hi);
+            const __m256i lo = _mm256_or_si256(_mm256_blend_epi32(x, _mm256_setzero_si256(), 0xAA), exp_lo);
+            const __m256d d = _mm256_add_pd(_mm256_sub_pd(_mm256_castsi256_pd(hi), bias_hi),
+                                            _mm256_sub_pd(_mm256_castsi256_pd(lo), bias_lo));
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(d, scale4));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = static_cast<double>(bits[i] >> 11) * scale;
+        }
+    }
+
+    // The canonical floats (words >> 8) * 2^-24.
+    inline void canonical_convert(const std::uint32_t* words, float* out, std::size_t n)
+    {
+        const float scale = 1.0f / static_cast<float>(std::uint32_t { 1 } << 24);
+        std::size_t i = 0;
+#if defined(__AVX512F__)
+        const __m512 scale16 = _mm512_set1_ps(scale);
+        for (; i + 16 <= n; i += 16) {
+            const __m512i x = _mm512_srli_epi32(_mm512_loadu_si512(words + i), 8);
+            _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_cvtepi32_ps(x), scale16));
+        }
+#elif defined(__AVX2__)
+        const __m256 scale8 = _mm256_set1_ps(scale);
+        for (; i + 8 <= n; i += 8) {
+            const __m256i x = _mm256_srli_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i)), 8);
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x), scale8));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = static_cast<float>(words[i] >> 8) * scale;
+        }
+    }
+
+    template<class Engine>
+    inline void canonical_block(Engine& eng, double* out, std::size_t n)
+    {
+        std::uint64_t bits[canonical_block_size];
+        canonical_bits(eng, bits, n, canonical_by_generate<Engine>());
+        canonical_convert(bits, out, n);
+    }
+
+    template<class Engine>
+    inline void canonical_block(Engine& eng, float* out, std::size_t n)
+    {
+        std::uint32_t words[2 * canonical_block_size];
+        canonical_words(eng, words, n, canonical_by_generate<Engine>());
+        canonical_convert(words, out, n);
+    }
+
+} // namespace detail
+
+/**
+ * Writes @c n uniformly distributed values in [0, 1) to @c out, as
+ * (x >> 11) * 2^-53 for double and (y >> 8) * 2^-24 for float, x being a
+ * 64-bit and y a 32-bit value taken from @c eng, i.e. using the upper bits
+ * as the xoroshiro authors recommend. A 64-bit output gives one double or
+ * two floats (low word first), two 32-bit outputs give one double (the
+ * first in the low word) or a 32-bit output gives one float.
+ *
+ * The values are converted in blocks, with AVX2 or AVX-512 if enabled, the
+ * results do not depend on the instruction set. The bits are obtained
+ * through @c eng.generate() for engines with a vectorized generate(), f.e.
+ * splitmix64, taus88 and lfsr113.
+ *
+ * RealType is double or float, Engine must produce full-range 32- or
+ * 64-bit values.
+ */
+template<class RealType, class Engine, class OutputIt>
+void generate_canonical_bulk(Engine& eng, OutputIt out, std::size_t n)
+{
+    BOOST_STATIC_ASSERT((boost::is_same<RealType, double>::value || boost::is_same<RealType, float>::value));
+    typedef typename Engine::result_type result_type;
+    BOOST_STATIC_ASSERT(std::numeric_limits<result_type>::digits == 32 || std::numeric_limits<result_type>::digits == 64);
+    BOOST_ASSERT((eng.min)() == 0 && (eng.max)() == (std::numeric_limits<result_type>::max)());
+
+    // Real values per 64-bit value.
+    const std::size_t per_value = sizeof(std::uint64_t) / sizeof(RealType);
+
+    RealType reals[2 * detail::canonical_block_size];
+    while (n) {
+        const std::size_t m = (std::min)(n, per_value * detail::canonical_block_size);
+        detail::canonical_block(eng, reals, m);
+        out = std::copy(reals, reals + m, out);
+        n -= m;
+    }
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_GENERATE_CANONICAL_BULK_HPP
@@ -0,0 +1,271 @@
+/* boost random/instrumentation.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_INSTRUMENTATION_HPP
+#define BOOST_RANDOM_INSTRUMENTATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(BOOST_RANDOM_INSTRUMENTATION)
+#include <atomic>
+#include <mutex>
+#endif
+
+#include <boost/config.hpp>
+
+namespace boost {
+namespace random {
+
+/**
+ * The counters of an engine type. The engines of xoroshiro.hpp and
+ * complementary_multiply_with_carry.hpp count their use if
+ * BOOST_RANDOM_INSTRUMENTATION is defined (before any header of the
+ * library is included); without it the hooks expand to nothing and the
+ * engines compile to the same code as before.
+ *
+ * BOOST_RANDOM_INSTRUMENTATION changes the definitions of the inline
+ * member functions of the engines: it must be defined (or not) the same
+ * way in every translation unit of a program, on the command line rather
+ * than in a source file, otherwise the program violates the one
+ * definition rule and the linker keeps either version.
+ *
+ * The engines use splitmix64 internally (to seed a cmwc engine from a
+ * value, to replace an all-zero seed, in split()) through splitmix64::at(),
+ * that is not counted as use of splitmix64.
+ *
+ * The hooks are skipped in constant evaluation with
+ * __builtin_is_constant_evaluated() (GCC 9, Clang 9, MSVC 19.25 and
+ * later). An older compiler runs them in constant evaluation as well, so
+ * with BOOST_RANDOM_INSTRUMENTATION defined the engines can not be used
+ * in constant expressions there; BOOST_RANDOM_INSTRUMENTATION_CONSTEXPR
+ * is defined if they can.
+ */
+struct engine_counters
+{
+    /** The number of values returned by operator() and written by generate(). */
+    std::uint64_t values;
+    /** The number of calls of generate(). */
+    std::uint64_t bulk_calls;
+    /** The number of jumps, jump(z) counts z, long_jump() counts 1. */
+    std::uint64_t jumps;
+    /** The number of seedings, including those of the constructors. */
+    std::uint64_t reseeds;
+};
+
+/** The counters of an engine type, summed over all threads. */
+struct engine_statistics
+{
+    /**
+     * The name of the engine type, f.e. "xoroshiro128plus", with its
+     * parameters for the class templates.
+     */
+    const char* name;
+    engine_counters counters;
+};
+
+/// \cond show_private
+
+#if defined(BOOST_RANDOM_INSTRUMENTATION)
+
+// The hooks are skipped in constant evaluation, the engines stay constexpr.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define BOOST_RANDOM_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(BOOST_RANDOM_DETAIL_IS_CONSTANT_EVALUATED) && defined(_MSC_VER) && _MSC_VER >= 1925
+#define BOOST_RANDOM_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if defined(BOOST_RANDOM_DETAIL_IS_CONSTANT_EVALUATED)
+#define BOOST_RANDOM_INSTRUMENTATION_CONSTEXPR
+#else
+#define BOOST_RANDOM_DETAIL_IS_CONSTANT_EVALUATED() false
+#endif
+
+namespace detail {
+
+    const std::size_t max_instrumented_engines = 32;
+
+    enum engine_counter { counter_values, counter_bulk_calls, counter_jumps, counter_reseeds, counter_count };
+
+    struct instrumentation_thread;
+
+    /**
+     * The counter blocks of the live threads and the totals of the
+     * threads that have exited, behind a mutex: it is taken when a thread
+     * first counts, when it exits and by a snapshot, never by a hook.
+     */
+    struct instrumentation_registry
+    {
+        std::mutex mutex;
+        std::vector<instrumentation_thread*> threads;
+        std::uint64_t retired[max_instrumented_engines][counter_count];
+        const char* names[max_instrumented_engines];
+        std::size_t engines;
+
+        static instrumentation_registry& get()
+        {
+            static instrumentation_registry registry;
+            return registry;
+        }
+
+        // Returns the slot of a new engine type, max_instrumented_engines
+        // if all are taken (the type is not counted then).
+        std::size_t add(const char* name)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (engines == max_instrumented_engines) {
+                return max_instrumented_engines;
+            }
+            names[engines] = name;
+            return engines++;
+        }
+
+    private:
+        instrumentation_registry() : retired(), names(), engines(0) { }
+    };
+
+    /**
+     * The counters of a thread. Only the thread writes them, with a
+     * relaxed load and store instead of a locked read-modify-write, the
+     * atomics let a snapshot read them while the thread runs.
+     */
+    struct instrumentation_thread
+    {
+        std::atomic<std::uint64_t> counters[max_instrumented_engines][counter_count];
+
+        instrumentation_thread()
+        {
+            for (std::size_t i = 0; i < max_instrumented_engines; ++i) {
+                for (std::size_t j = 0; j < counter_count; ++j) {
+                    counters[i][j].store(0, std::memory_order_relaxed);
+                }
+            }
+            instrumentation_registry& registry = instrumentation_registry::get();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.threads.push_back(this);
+        }
+
+        // Folds the counts of the thread into the retired totals.
+        ~instrumentation_thread()
+        {
+            instrumentation_registry& registry = instrumentation_registry::get();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (std::size_t i = 0; i < max_instrumented_engines; ++i) {
+                for (std::size_t j = 0; j < counter_count; ++j) {
+                    registry.retired[i][j] += counters[i][j].load(std::memory_order_relaxed);
+                }
+            }
+            for (std::size_t i = 0; i < registry.threads.size(); ++i) {
+                if (registry.threads[i] == this) {
+                    registry.threads[i] = registry.threads.back();
+                    registry.threads.pop_back();
+                    break;
+                }
+            }
+        }
+
+        instrumentation_thread(const instrumentation_thread&) = delete;
+        instrumentation_thread& operator=(const instrumentation_thread&) = delete;
+    };
+
+    inline instrumentation_thread& this_instrumentation_thread()
+    {
+        thread_local instrumentation_thread counters;
+        return counters;
+    }
+
+    // The name is that of the instrumentation_name() friend of the engine,
+    // see BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME, found by ADL.
+    template<class Engine>
+    inline std::size_t instrumentation_slot()
+    {
+        static const std::size_t slot = instrumentation_registry::get().add(instrumentation_name(static_cast<const Engine*>(0)));
+        return slot;
+    }
+
+    template<class Engine>
+    BOOST_NOINLINE void instrument(engine_counter counter, std::uint64_t n)
+    {
+        const std::size_t slot = instrumentation_slot<Engine>();
+        if (slot < max_instrumented_engines) {
+            std::atomic<std::uint64_t>& c = this_instrumentation_thread().counters[slot][counter];
+            c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+    }
+
+} // namespace detail
+
+// Names an instrumented engine in the snapshot, name being a const char*
+// expression, evaluated when the engine first counts.
+#define BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(Self, name)                                                  \
+    friend const char* instrumentation_name(const Self*) { return name; }
+
+#define BOOST_RANDOM_DETAIL_INSTRUMENT(Self, counter, n)                                                      \
+    do {                                                                                                        \
+        if (!BOOST_RANDOM_DETAIL_IS_CONSTANT_EVALUATED()) {                                                     \
+            ::boost::random::detail::instrument<Self>(::boost::random::detail::counter_##counter, (n));         \
+        }                                                                                                       \
+    } while (0)
+
+#else
+
+#define BOOST_RANDOM_INSTRUMENTATION_CONSTEXPR
+#define BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(Self, name)
+#define BOOST_RANDOM_DETAIL_INSTRUMENT(Self, counter, n)
+
+#endif
+
+/// \endcond
+
+/** True if the engines count their use. */
+#if defined(BOOST_RANDOM_INSTRUMENTATION)
+BOOST_STATIC_CONSTEXPR bool instrumentation_enabled = true;
+#else
+BOOST_STATIC_CONSTEXPR bool instrumentation_enabled = false;
+#endif
+
+/**
+ * Returns the counters of the engine types used so far, summed over the
+ * live threads and the threads that have exited, in the order of their
+ * first use. The counters of a running thread are read as they are, the
+ * snapshot is not a consistent cut. Empty unless BOOST_RANDOM_INSTRUMENTATION
+ * is defined.
+ */
+inline std::vector<engine_statistics> instrumentation_snapshot()
+{
+    std::vector<engine_statistics> snapshot;
+#if defined(BOOST_RANDOM_INSTRUMENTATION)
+    detail::instrumentation_registry& registry = detail::instrumentation_registry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (std::size_t i = 0; i < registry.engines; ++i) {
+        std::uint64_t c[detail::counter_count];
+        for (std::size_t j = 0; j < detail::counter_count; ++j) {
+            c[j] = registry.retired[i][j];
+            for (std::size_t t = 0; t < registry.threads.size(); ++t) {
+                c[j] += registry.threads[t]->counters[i][j].load(std::memory_order_relaxed);
+            }
+        }
+        const engine_statistics s = { registry.names[i], { c[detail::counter_values], c[detail::counter_bulk_calls], c[detail::counter_jumps], c[detail::counter_reseeds] } };
+        snapshot.push_back(s);
+    }
+#endif
+    return snapshot;
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_INSTRUMENTATION_HPP
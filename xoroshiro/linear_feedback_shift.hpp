@@ -17,10 +17,12 @@
 
 #include <iosfwd>
 #include <stdexcept>
+#include <boost/limits.hpp>
 #include <boost/config.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/integer/integer_mask.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/random/detail/config.hpp>
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/operators.hpp>
@@ -29,6 +31,19 @@
 namespace boost {
 namespace random {
 
+namespace detail {
+
+template<class Engine>
+struct tausworthe_lanes;
+
+template<class Engine>
+struct seed_words;
+
+template<class Engine>
+struct binary_state_access;
+
+} // namespace detail
+
 /**
  * Instatiations of @c linear_feedback_shift model a
  * \pseudo_random_number_generator.  It was originally
@@ -116,9 +131,7 @@ public:
     /** Returns the next value of the generator. */
     result_type operator()()
     {
-        const UIntType b = (((value << q) ^ value) & wordmask()) >> (k-s);
-        const UIntType mask = (wordmask() << (w-k)) & wordmask();
-        value = ((value & mask) << s) ^ b;
+        value = step(value);
         return value;
     }
 
@@ -127,11 +140,25 @@ public:
     void generate(Iter first, Iter last)
     { detail::generate_from_int(*this, first, last); }
 
-    /** Advances the state of the generator by @c z. */
+    /**
+     * Advances the state of the generator by @c z. The generator is
+     * linear over GF(2), for large @c z the state is multiplied by
+     * the precomputed powers M^(2^i) of the w x w transition matrix M,
+     * corresponding to the set bits of @c z, i.e. in O(w * log(z)).
+     */
     void discard(boost::uintmax_t z)
     {
-        for(boost::uintmax_t j = 0; j < z; ++j) {
-            (*this)();
+        if(z <= boost::uintmax_t(w)) {
+            for(boost::uintmax_t j = 0; j < z; ++j) {
+                (*this)();
+            }
+            return;
+        }
+        const jump_table& table = jump_powers();
+        for(int i = 0; z != 0; ++i, z >>= 1) {
+            if(z & 1) {
+                value = table.apply(i, value);
+            }
         }
     }
 
@@ -168,7 +195,63 @@ public:
 
 private:
     /// \cond show_private
-    static UIntType wordmask() { return boost::low_bits_mask_t<w>::sig_bits; }
+    template<class Engine> friend struct detail::tausworthe_lanes;
+    template<class Engine> friend struct detail::binary_state_access;
+
+    BOOST_STATIC_CONSTANT(UIntType, word_mask =
+        boost::low_bits_mask_t<w>::sig_bits);
+    BOOST_STATIC_CONSTANT(UIntType, state_mask =
+        (boost::low_bits_mask_t<w>::sig_bits << (w-k))
+            & boost::low_bits_mask_t<w>::sig_bits);
+
+    static UIntType wordmask() { return word_mask; }
+    static UIntType statemask() { return state_mask; }
+
+    static UIntType step(UIntType x)
+    {
+        const UIntType b = (((x << q) ^ x) & wordmask()) >> (k-s);
+        return ((x & statemask()) << s) ^ b;
+    }
+
+    /**
+     * The powers M^(2^i) of the transition matrix M, stored as columns,
+     * i.e. column j of M^(2^i) is the image of bit j.
+     */
+    struct jump_table
+    {
+        BOOST_STATIC_CONSTANT(int, powers =
+            std::numeric_limits<boost::uintmax_t>::digits);
+
+        jump_table()
+        {
+            for(int j = 0; j < w; ++j) {
+                column[0][j] = step(UIntType(1) << j);
+            }
+            for(int i = 1; i < powers; ++i) {
+                for(int j = 0; j < w; ++j) {
+                    column[i][j] = apply(i - 1, column[i - 1][j]);
+                }
+            }
+        }
+
+        UIntType apply(int i, UIntType x) const
+        {
+            UIntType r = 0;
+            for(int j = 0; j < w; ++j) {
+                r ^= column[i][j] & (UIntType(0) - ((x >> j) & UIntType(1)));
+            }
+            return r;
+        }
+
+        UIntType column[powers][w];
+    };
+
+    // Computed once per instantiation, on first use.
+    static const jump_table& jump_powers()
+    {
+        static const jump_table table;
+        return table;
+    }
     /// \endcond
     UIntType value;
 };
@@ -187,8 +270,21 @@ template<class UIntType, int w, int k, int q, int s>
 const int linear_feedback_shift_engine<UIntType, w, k, q, s>::step_size;
 template<class UIntType, int w, int k, int q, int s>
 const UIntType linear_feedback_shift_engine<UIntType, w, k, q, s>::default_seed;
+template<class UIntType, int w, int k, int q, int s>
+const UIntType linear_feedback_shift_engine<UIntType, w, k, q, s>::word_mask;
+template<class UIntType, int w, int k, int q, int s>
+const UIntType linear_feedback_shift_engine<UIntType, w, k, q, s>::state_mask;
 #endif
 
+namespace detail {
+
+/** @c seed(first, last) consumes a single value of up to w bits. */
+template<class UIntType, int w, int k, int q, int s>
+struct seed_words<linear_feedback_shift_engine<UIntType, w, k, q, s> >
+  : boost::integral_constant<std::size_t, (w + 31) / 32> {};
+
+} // namespace detail
+
 /// \cond show_deprecated
 
 /** Provided for backwards compatibility. */
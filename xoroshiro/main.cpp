@@ -5,8 +5,12 @@
 
 #include <iostream>
 #include <sstream>
+#include <vector>
+#include <numeric>
 #include <random>
 #include <cstdint>
+#include <cstdlib>
+#include <new>
 
 #include <functional>
 #include "taus88.hpp"
@@ -14,8 +18,26 @@
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/seed_seq.hpp>
 #include <boost/random/random_device.hpp>
+#include <boost/random/normal_distribution.hpp>
+#include <boost/random/discrete_distribution.hpp>
+#include <boost/align/aligned_alloc.hpp>
 #include "seed_seq_fe.hpp"
 #include "xoroshiro.hpp"
+#include "seed_many.hpp"
+#include "generate_canonical_bulk.hpp"
+#include "uniform_bounded.hpp"
+#include "ziggurat.hpp"
+#include "bit_stream.hpp"
+#include "alias_table.hpp"
+#include "shuffle.hpp"
+#include "buffered_engine.hpp"
+#include "async_random_pool.hpp"
+#include "thread_engine.hpp"
+#include "engine_view.hpp"
+#include "binary_state.hpp"
+#include "engine_bank.hpp"
+#include "instrumentation.hpp"
+#include "quality_monitor.hpp"
 #include "complementary_multiply_with_carry.hpp"
 
 #include <pcg/pcg_random.hpp>
@@ -36,41 +58,70 @@ std::uint64_t integer_hash ( std::uint64_t x )
 
 #define VOLATILE volatile
 
-template<typename Generator>
-struct GeneratorCache : private Generator {
 
-    using result_type = typename Generator::result_type;
-    using size_type = std::size_t;
+// Counts the calls to the global operator new, used to verify that the
+// seeding of the generators does not allocate. Every replaced allocation
+// function has its matching deallocation functions (plain, array, sized and
+// aligned). They are not inlined, so that the compiler pairs the operator
+// new and delete calls, and not the malloc ( ) and free ( ) inside them
+// (-Wmismatched-new-delete).
+std::size_t allocation_count = 0;
 
-    GeneratorCache ( ) : Generator ( ) { }
-    GeneratorCache ( result_type v_ ) : Generator ( v_ ) { }
-    template<typename SeedSeq>
-    GeneratorCache ( const SeedSeq & seq_ ) : Generator ( seq_ ) { }
-    template<typename It>
-    GeneratorCache ( It & first_, It last_ ) : Generator ( first_, last_ ) { }
+BOOST_NOINLINE void * operator new ( std::size_t size ) {
+    ++allocation_count;
+    if ( void * p = std::malloc ( size ) )
+        return p;
+    throw std::bad_alloc { };
+}
 
-    result_type operator ( ) ( ) noexcept {
+BOOST_NOINLINE void * operator new [ ] ( std::size_t size ) {
+    return ::operator new ( size );
+}
 
-        if ( m_index == data_size ( ) ) {
+BOOST_NOINLINE void operator delete ( void * p ) noexcept {
+    std::free ( p );
+}
 
-            Generator::generate ( std::begin ( m_data ), std::end ( m_data ) );
-            // std::generate ( std::begin ( m_data ), std::end ( m_data ), [ this ] ( ) { return Generator::operator ( ) ( ); } );
-            m_index = 1;
+BOOST_NOINLINE void operator delete [ ] ( void * p ) noexcept {
+    ::operator delete ( p );
+}
 
-            return m_data [ 0 ];
-        }
+BOOST_NOINLINE void operator delete ( void * p, std::size_t ) noexcept {
+    ::operator delete ( p );
+}
 
-        return m_data [ m_index++ ];
-    }
+BOOST_NOINLINE void operator delete [ ] ( void * p, std::size_t ) noexcept {
+    ::operator delete ( p );
+}
 
-    static constexpr result_type min ( ) noexcept { return Generator::min ( ); }
-    static constexpr result_type max ( ) noexcept { return Generator::max ( ); }
-    static constexpr std::size_t data_size ( ) noexcept { return 64 / sizeof ( result_type ); }
+#if defined ( __cpp_aligned_new )
+BOOST_NOINLINE void * operator new ( std::size_t size, std::align_val_t align ) {
+    ++allocation_count;
+    if ( void * p = boost::alignment::aligned_alloc ( static_cast<std::size_t> ( align ), size ) )
+        return p;
+    throw std::bad_alloc { };
+}
 
-    result_type m_data [ data_size ( ) ];
-    size_type m_index = data_size ( );
-};
+BOOST_NOINLINE void * operator new [ ] ( std::size_t size, std::align_val_t align ) {
+    return ::operator new ( size, align );
+}
+
+BOOST_NOINLINE void operator delete ( void * p, std::align_val_t ) noexcept {
+    boost::alignment::aligned_free ( p );
+}
+
+BOOST_NOINLINE void operator delete [ ] ( void * p, std::align_val_t align ) noexcept {
+    ::operator delete ( p, align );
+}
+
+BOOST_NOINLINE void operator delete ( void * p, std::size_t, std::align_val_t align ) noexcept {
+    ::operator delete ( p, align );
+}
 
+BOOST_NOINLINE void operator delete [ ] ( void * p, std::size_t, std::align_val_t align ) noexcept {
+    ::operator delete ( p, align );
+}
+#endif
 
 int main ( ) {
 
@@ -244,6 +295,1277 @@ std::uint32_t CMWC4096 ( ) {
     return ( Q2 [ i ] = r - x );
 }
 
+int main_seed_xor_combine ( ) {
+
+    boost::random::seed_seq_fe256 seq { INT32_MAX, 3466, 456454, 23423 };
+
+    const std::int64_t n = 10'000'000;
+    std::int64_t cnt1 = n, cnt2 = n;
+
+    VOLATILE std::uint32_t acc = 0;
+
+    const std::size_t allocations = allocation_count;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            boost::random::taus88 gen ( seq );
+            acc += gen ( );
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            boost::random::lfsr113 gen ( seq );
+            acc += gen ( );
+        }
+    }
+
+    std::cout << "allocations per seed: " << static_cast<double> ( allocation_count - allocations ) / ( 2 * n ) << '\n';
+
+    return 0;
+}
+
+
+int main_seed_seq_fe ( ) {
+
+    const std::int64_t n = 1'000'000;
+    std::int64_t cnt1 = n, cnt2 = n;
+
+    VOLATILE std::uint32_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            const boost::random::seed_seq_fe256 seq { static_cast<std::uint32_t> ( cnt1 ), 3466u, 456454u, 23423u, 1u, 2u, 3u, 4u };
+            acc += seq.size ( );
+        }
+    }
+
+    const boost::random::seed_seq_fe256 seq { INT32_MAX, 3466, 456454, 23423 };
+    std::uint32_t data [ 1'024 ];
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            seq.generate ( std::begin ( data ), std::end ( data ) );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+
+    return 0;
+}
+
+
+// A seed sequence generating all zeros, forcing the zero-state recovery
+// from param ( ) in the seeding of the xoroshiro generators.
+struct zero_seed_seq {
+
+    using result_type = std::uint32_t;
+
+    template<typename It>
+    void generate ( It first_, It last_ ) const noexcept {
+        std::fill ( first_, last_, result_type { 0 } );
+    }
+
+    std::size_t size ( ) const noexcept {
+        return 4;
+    }
+
+    template<typename It>
+    void param ( It dest_ ) const noexcept {
+        const result_type p [ 4 ] { INT32_MAX, 3466, 456454, 23423 };
+        std::copy ( std::begin ( p ), std::end ( p ), dest_ );
+    }
+};
+
+// Seeding from seed_seq_fe (or any SeedSeq with a noexcept generate ( ) and
+// param ( )) is noexcept, seeding from std::seed_seq is not.
+static_assert ( noexcept ( boost::random::xoroshiro128plus ( std::declval<const boost::random::seed_seq_fe128&> ( ) ) ), "seeding from seed_seq_fe is not noexcept" );
+static_assert ( noexcept ( std::declval<boost::random::xoshiro256starstar&> ( ).seed ( std::declval<boost::random::seed_seq_fe256&> ( ) ) ), "seeding from seed_seq_fe is not noexcept" );
+static_assert ( noexcept ( boost::random::splitmix64 ( std::declval<boost::random::seed_seq_fe128&> ( ) ) ), "seeding from seed_seq_fe is not noexcept" );
+static_assert ( noexcept ( boost::random::xorshift1024star ( std::declval<const zero_seed_seq&> ( ) ) ), "seeding from zero_seed_seq is not noexcept" );
+static_assert ( not noexcept ( boost::random::xoroshiro128plus ( std::declval<std::seed_seq&> ( ) ) ), "seeding from std::seed_seq is noexcept" );
+
+int main_seed_zero_recovery ( ) {
+
+    const boost::random::seed_seq_fe128 seq { INT32_MAX, 3466, 456454, 23423 };
+    const zero_seed_seq zero_seq;
+
+    const std::int64_t n = 10'000'000;
+    std::int64_t cnt1 = n, cnt2 = n;
+
+    VOLATILE std::uint64_t acc = 0;
+
+    const std::size_t allocations = allocation_count;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            boost::random::xoroshiro128plus gen ( seq );
+            acc += gen ( );
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            boost::random::xoroshiro128plus gen ( zero_seq );
+            acc += gen ( );
+        }
+    }
+
+    std::cout << "allocations per seed: " << static_cast<double> ( allocation_count - allocations ) / ( 2 * n ) << '\n';
+
+    return 0;
+}
+
+
+int main_seed_many ( ) {
+
+    const std::size_t n = 1'000'000;
+
+    std::vector<boost::random::xoroshiro128plus> engines ( n );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( std::size_t i = 0; i < n; ++i ) {
+            boost::random::seed_seq_fe128 seq { static_cast<std::uint32_t> ( i ), 3466u, 456454u, 23423u };
+            engines [ i ].seed ( seq );
+        }
+    }
+
+    acc += engines [ n - 1 ] ( );
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::seed_seq_fe128 seq { INT32_MAX, 3466, 456454, 23423 };
+        boost::random::seed_many ( seq, engines.data ( ), engines.data ( ) + n );
+    }
+
+    acc += engines [ n - 1 ] ( );
+
+    // Engine 0 gets the state of its SeedSeq seed ( ) from seed_seq_fe (whatever
+    // the number of engines), from std::seed_seq only as the only engine. The
+    // engines at the same position of two blocks (of 256 engines) differ.
+    {
+        boost::random::seed_seq_fe128 seq { INT32_MAX, 3466, 456454, 23423 };
+        std::seed_seq std_seq { INT32_MAX, 3466, 456454, 23423 };
+        boost::random::seed_many ( seq, engines.data ( ), engines.data ( ) + 1'000 );
+        bool equal = engines [ 0 ] == boost::random::xoroshiro128plus ( seq ) and engines [ 1 ] != engines [ 257 ];
+        boost::random::seed_many ( std_seq, engines.data ( ), engines.data ( ) + 1 );
+        equal = equal and engines [ 0 ] == boost::random::xoroshiro128plus ( std_seq );
+        std::cout << "seed_many engine 0 " << std::boolalpha << equal << '\n';
+    }
+
+    return 0;
+}
+
+
+// The bulk generate ( ) of taus88 and lfsr113 (AVX2 in AVX2 builds) writes
+// the values operator ( ) returns and leaves the engine in the same state,
+// for every length (the remainder of a block of 4 steps included).
+
+template<typename G>
+bool tausworthe_generate_equal ( ) {
+
+    G gen1 ( 0xBE1C0467u ), gen2 ( gen1 );
+    std::uint32_t data [ 1'031 ];
+
+    for ( std::size_t n = 0; n < 40; ++n ) {
+        gen1.generate ( data, data + n );
+        for ( std::size_t i = 0; i < n; ++i )
+            if ( data [ i ] != gen2 ( ) )
+                return false;
+        if ( gen1 != gen2 )
+            return false;
+    }
+
+    gen1.generate ( std::begin ( data ), std::end ( data ) );
+    for ( const std::uint32_t v : data )
+        if ( v != gen2 ( ) )
+            return false;
+
+    return gen1 == gen2;
+}
+
+template<typename G>
+void bench_tausworthe_generate ( const char * name_ ) {
+
+    const std::int64_t n = 500'000;
+    std::int64_t cnt1 = n, cnt2 = n;
+
+    G gen1 ( 0xBE1C0467u ), gen2 ( gen1 );
+    std::uint32_t data [ 1'024 ];
+
+    VOLATILE std::uint64_t acc = 0;
+
+    std::cout << name_ << " operator ( ) ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            for ( std::uint32_t & v : data )
+                v = gen1 ( );
+            acc += data [ cnt1 & 1'023 ];
+        }
+    }
+
+    std::cout << name_ << " generate ( )  ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            gen2.generate ( std::begin ( data ), std::end ( data ) );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+}
+
+int main_tausworthe_generate ( ) {
+
+    bench_tausworthe_generate<boost::random::taus88> ( "taus88 " );
+    bench_tausworthe_generate<boost::random::lfsr113> ( "lfsr113" );
+
+    std::cout << "generate equals operator ( ) " << std::boolalpha
+        << ( tausworthe_generate_equal<boost::random::taus88> ( ) && tausworthe_generate_equal<boost::random::lfsr113> ( ) ) << '\n';
+
+    return 0;
+}
+
+
+// The jump of discard ( z ) of taus88 and lfsr113 (powers of the transition
+// matrices of the components) leaves the engine in the state z calls of
+// operator ( ) leave it in, and jumps compose, also for z too large to step.
+
+template<typename G>
+bool tausworthe_discard_equal ( ) {
+
+    for ( const std::uint64_t z : { 0ull, 1ull, 32ull, 33ull, 100ull, 1'000ull, 65'537ull, 1'000'003ull } ) {
+        G jumped ( 0xBE1C0467u ), stepped ( jumped );
+        jumped.discard ( z );
+        for ( std::uint64_t i = 0; i < z; ++i )
+            stepped ( );
+        if ( jumped != stepped )
+            return false;
+    }
+
+    G once ( 0xBE1C0467u ), twice ( once );
+    once.discard ( 0x0123'4567'89AB'CDEFull + 0x0FED'CBA9'8765ull );
+    twice.discard ( 0x0123'4567'89AB'CDEFull );
+    twice.discard ( 0x0FED'CBA9'8765ull );
+
+    return once == twice;
+}
+
+int main_tausworthe_discard ( ) {
+
+    const std::int64_t n = 1'000'000;
+    std::int64_t cnt = n;
+
+    boost::random::lfsr113 gen ( 0xBE1C0467u );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    std::cout << "lfsr113 discard ( 2^40 + i ) ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt-- ) {
+            gen.discard ( ( std::uint64_t { 1 } << 40 ) + static_cast<std::uint64_t> ( cnt ) );
+            acc += gen ( );
+        }
+    }
+
+    std::cout << "discard equals stepping " << std::boolalpha
+        << ( tausworthe_discard_equal<boost::random::taus88> ( ) && tausworthe_discard_equal<boost::random::lfsr113> ( ) ) << '\n';
+
+    return 0;
+}
+
+
+int main_splitmix64_generate ( ) {
+
+    const std::int64_t n = 1'000'000;
+    std::int64_t cnt1 = n, cnt2 = n, cnt3 = n;
+
+    boost::random::splitmix64 gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 );
+    std::uint32_t data [ 1'024 ];
+    std::uint64_t values [ 512 ];
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            boost::random::detail::generate_from_int ( gen1, std::begin ( data ), std::end ( data ) );
+            acc += data [ cnt1 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            gen2.generate ( std::begin ( data ), std::end ( data ) );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt3-- ) {
+            boost::random::splitmix64::generate_at ( 0xBE1C0467EBA5FAC1, static_cast<std::uint64_t> ( cnt3 ) * 512, std::begin ( values ), 512 );
+            acc += values [ cnt3 & 511 ];
+        }
+    }
+
+    std::cout << std::boolalpha << ( gen1 == gen2 ) << '\n';
+
+    return 0;
+}
+
+
+// The stream format of splitmix64 round trips, the format of the
+// splitmix64 with a fixed gamma (the state alone) reads with the default
+// gamma, also several states in a row, and an even gamma fails the
+// stream.
+
+int main_splitmix64_io ( ) {
+
+    boost::random::splitmix64 gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( 0xBE2C0467EBA5FAC2 );
+    boost::random::splitmix64 child = gen1.split ( );
+
+    bool ok = true;
+
+    {
+        std::stringstream ss;
+        ss << gen1 << ' ' << child << ' ' << gen2;
+        boost::random::splitmix64 r1, r2, r3;
+        ss >> r1 >> r2 >> r3;
+        ok = ok && !ss.fail ( ) && r1 == gen1 && r2 == child && r3 == gen2;
+    }
+
+    {
+        // Consecutive states of the old format.
+        std::stringstream ss ( "12345 67890\n" );
+        boost::random::splitmix64 r1 ( 1 ), r2 ( 1 );
+        ss >> r1 >> r2;
+        std::ostringstream os;
+        os << r1 << ' ' << r2;
+        ok = ok && !ss.fail ( ) && os.str ( ) == "12345 67890";
+    }
+
+    {
+        std::stringstream ss ( "12345 g67890" );
+        boost::random::splitmix64 r ( gen2 );
+        ss >> r;
+        ok = ok && ss.fail ( ) && r == gen2;
+    }
+
+    std::cout << "splitmix64 io " << std::boolalpha << ok << '\n';
+
+    return ok ? 0 : 1;
+}
+
+
+int main_generate_canonical_bulk ( ) {
+
+    const std::int64_t n = 100'000;
+    std::int64_t cnt1 = n, cnt2 = n, cnt3 = n, cnt4 = n;
+
+    boost::random::xoroshiro128plus gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 );
+    boost::random::splitmix64 gen3 ( 0xBE1C0467EBA5FAC1 );
+    double data [ 1'024 ];
+    float fdata [ 1'024 ];
+
+    VOLATILE double acc = 0.0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen1 ] ( ) { return std::generate_canonical<double, 53> ( gen1 ); } );
+            acc += data [ cnt1 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            boost::random::generate_canonical_bulk<double> ( gen2, std::begin ( data ), 1'024 );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt3-- ) {
+            boost::random::generate_canonical_bulk<double> ( gen3, std::begin ( data ), 1'024 );
+            acc += data [ cnt3 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt4-- ) {
+            boost::random::generate_canonical_bulk<float> ( gen2, std::begin ( fdata ), 1'024 );
+            acc += fdata [ cnt4 & 1'023 ];
+        }
+    }
+
+    return 0;
+}
+
+
+int main_uniform_bounded ( ) {
+
+    const std::int64_t n = 100'000;
+    std::int64_t cnt1 = n, cnt2 = n, cnt3 = n;
+
+    boost::random::xoroshiro128plus gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 ), gen3 ( gen1 );
+    const std::uint32_t bound = 1'000'003;
+    std::uint32_t data [ 1'024 ];
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        std::uniform_int_distribution<std::uint32_t> dis ( 0, bound - 1 );
+
+        while ( cnt1-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen1, &dis ] ( ) { return dis ( gen1 ); } );
+            acc += data [ cnt1 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen2, bound ] ( ) { return boost::random::uniform_bounded ( gen2, bound ); } );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt3-- ) {
+            boost::random::generate_bounded ( gen3, bound, std::begin ( data ), 1'024 );
+            acc += data [ cnt3 & 1'023 ];
+        }
+    }
+
+    return 0;
+}
+
+
+int main_ziggurat ( ) {
+
+    const std::int64_t n = 100'000;
+    std::int64_t cnt1 = n, cnt2 = n, cnt3 = n, cnt4 = n;
+
+    boost::random::xoroshiro128plus gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 ), gen3 ( gen1 ), gen4 ( gen1 );
+    double data [ 1'024 ];
+
+    VOLATILE double acc = 0.0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::normal_distribution<double> dis;
+
+        while ( cnt1-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen1, &dis ] ( ) { return dis ( gen1 ); } );
+            acc += data [ cnt1 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::ziggurat_normal_distribution<double> dis;
+
+        while ( cnt2-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen2, &dis ] ( ) { return dis ( gen2 ); } );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::ziggurat_normal_distribution<double> dis;
+
+        while ( cnt3-- ) {
+            dis.generate ( gen3, std::begin ( data ), 1'024 );
+            acc += data [ cnt3 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::ziggurat_exponential_distribution<double> dis;
+
+        while ( cnt4-- ) {
+            dis.generate ( gen4, std::begin ( data ), 1'024 );
+            acc += data [ cnt4 & 1'023 ];
+        }
+    }
+
+    return 0;
+}
+
+
+int main_bernoulli_fill ( ) {
+
+    const std::int64_t n = 100'000;
+    std::int64_t cnt1 = n, cnt2 = n, cnt3 = n;
+
+    boost::random::xoroshiro128plus gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 ), gen3 ( gen1 );
+    std::uint64_t bitmap [ 16 ];
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        std::bernoulli_distribution dis ( 0.3 );
+
+        while ( cnt1-- ) {
+            std::fill ( std::begin ( bitmap ), std::end ( bitmap ), 0 );
+            for ( int i = 0; i < 1'024; ++i )
+                bitmap [ i >> 6 ] |= std::uint64_t { dis ( gen1 ) } << ( i & 63 );
+            acc += bitmap [ cnt1 & 15 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::bit_stream<boost::random::xoroshiro128plus> bits ( gen2 );
+
+        while ( cnt2-- ) {
+            std::fill ( std::begin ( bitmap ), std::end ( bitmap ), 0 );
+            for ( int i = 0; i < 1'024; ++i )
+                bitmap [ i >> 6 ] |= std::uint64_t { bits ( ) } << ( i & 63 );
+            acc += bitmap [ cnt2 & 15 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::bit_stream<boost::random::xoroshiro128plus> bits ( gen3 );
+
+        while ( cnt3-- ) {
+            boost::random::bernoulli_fill ( bits, 0.3, bitmap, 1'024 );
+            acc += bitmap [ cnt3 & 15 ];
+        }
+    }
+
+    return 0;
+}
+
+
+int main_alias_discrete_distribution ( ) {
+
+    const std::int64_t n = 10'000;
+    std::int64_t cnt1 = n, cnt2 = n, cnt3 = n;
+
+    boost::random::xoroshiro128plusshixo gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 ), gen3 ( gen1 );
+
+    std::vector<double> weights ( 1'000'000 );
+    boost::random::splitmix64 wgen ( 0xBE1C0467EBA5FAC1 );
+    std::generate ( std::begin ( weights ), std::end ( weights ), [ &wgen ] ( ) { return static_cast<double> ( wgen ( ) >> 40 ); } );
+
+    boost::random::discrete_distribution<int, double> dis1 ( std::begin ( weights ), std::end ( weights ) );
+    boost::random::alias_discrete_distribution<int> dis2 ( std::begin ( weights ), std::end ( weights ) );
+
+    int data [ 1'024 ];
+
+    VOLATILE std::int64_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt1-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen1, &dis1 ] ( ) { return dis1 ( gen1 ); } );
+            acc += data [ cnt1 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt2-- ) {
+            std::generate ( std::begin ( data ), std::end ( data ), [ &gen2, &dis2 ] ( ) { return dis2 ( gen2 ); } );
+            acc += data [ cnt2 & 1'023 ];
+        }
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt3-- ) {
+            dis2.generate ( gen3, std::begin ( data ), 1'024 );
+            acc += data [ cnt3 & 1'023 ];
+        }
+    }
+
+    return 0;
+}
+
+
+int main_shuffle ( ) {
+
+    std::vector<std::uint32_t> data ( 50'000'000 ), out ( 1'000 );
+
+    boost::random::xoroshiro128plus gen1 ( 0xBE1C0467EBA5FAC1 ), gen2 ( gen1 ), gen3 ( gen1 ), gen4 ( gen1 );
+
+    for ( std::size_t i = 0; i < data.size ( ); ++i )
+        data [ i ] = static_cast<std::uint32_t> ( i );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        std::shuffle ( std::begin ( data ), std::end ( data ), gen1 );
+        acc += data [ 0 ];
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::shuffle ( std::begin ( data ), std::end ( data ), gen2 );
+        acc += data [ 0 ];
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        std::sample ( std::begin ( data ), std::end ( data ), std::begin ( out ), out.size ( ), gen3 );
+        acc += out [ 0 ];
+    }
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::sample ( std::begin ( data ), std::end ( data ), std::begin ( out ), out.size ( ), gen4 );
+        acc += out [ 0 ];
+    }
+
+    return 0;
+}
+
+
+template<typename Generator>
+void bench_buffered_engine ( const char * name_ ) {
+
+    const std::int64_t n = 500'000'000;
+    std::int64_t cnt = n;
+
+    Generator gen ( 0xBE1C0467EBA5FAC1 );
+
+    VOLATILE std::uint64_t acc = 0;
+    std::uint64_t sum = 0;
+
+    std::cout << name_;
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        while ( cnt-- )
+            sum += gen ( );
+    }
+
+    acc += sum;
+}
+
+int main_buffered_engine ( ) {
+
+    bench_buffered_engine<boost::random::xoroshiro128plus> ( "xoroshiro128plus " );
+    bench_buffered_engine<boost::random::buffered_engine<boost::random::xoroshiro128plus, 64>> ( "buffered 64      " );
+    bench_buffered_engine<boost::random::buffered_engine<boost::random::xoroshiro128plus, 512>> ( "buffered 512     " );
+    bench_buffered_engine<boost::random::buffered_engine<boost::random::xoroshiro128plus, 4'096>> ( "buffered 4096    " );
+
+    bench_buffered_engine<boost::random::splitmix64> ( "splitmix64       " );
+    bench_buffered_engine<boost::random::buffered_engine<boost::random::splitmix64, 64>> ( "buffered 64      " );
+    bench_buffered_engine<boost::random::buffered_engine<boost::random::splitmix64, 512>> ( "buffered 512     " );
+    bench_buffered_engine<boost::random::buffered_engine<boost::random::splitmix64, 4'096>> ( "buffered 4096    " );
+
+    return 0;
+}
+
+
+int main_async_random_pool ( ) {
+
+    const std::int64_t n = 100'000'000;
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        boost::random::xoroshiro128plus gen ( 0xBE1C0467EBA5FAC1 );
+
+        std::int64_t cnt = n;
+        std::uint64_t sum = 0;
+
+        std::cout << "xoroshiro128plus ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            while ( cnt-- )
+                sum += gen ( );
+        }
+
+        acc += sum;
+    }
+
+    {
+        using pool_type = boost::random::async_random_pool<boost::random::xoroshiro128plus>;
+
+        pool_type pool ( boost::random::xoroshiro128plus ( 0xBE1C0467EBA5FAC1 ) );
+        pool_type::consumer gen ( pool );
+
+        std::int64_t cnt = n;
+        std::uint64_t sum = 0;
+
+        std::cout << "pool consumer    ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            while ( cnt-- )
+                sum += gen ( );
+        }
+
+        acc += sum;
+
+        const pool_type::statistics stats = pool.stats ( );
+
+        std::cout << "blocks " << stats.blocks << ", underflows " << stats.underflows << ", refill " << ( stats.blocks ? stats.refill_time.count ( ) / stats.blocks : 0 ) << " ns mean, " << stats.max_refill_time.count ( ) << " ns max\n";
+    }
+
+    return 0;
+}
+
+
+int main_thread_engine ( ) {
+
+    const std::int64_t n = 500'000'000;
+
+    VOLATILE std::uint64_t acc = 0;
+
+    {
+        boost::random::xoroshiro128plusshixo gen ( 0xBE1C0467EBA5FAC1 );
+
+        std::int64_t cnt = n;
+        std::uint64_t sum = 0;
+
+        std::cout << "local engine  ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            while ( cnt-- )
+                sum += gen ( );
+        }
+
+        acc += sum;
+    }
+
+    {
+        std::int64_t cnt = n;
+        std::uint64_t sum = 0;
+
+        std::cout << "thread_engine ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            while ( cnt-- )
+                sum += boost::random::thread_engine<boost::random::xoroshiro128plusshixo> ( ) ( );
+        }
+
+        acc += sum;
+    }
+
+    return 0;
+}
+
+
+int main_engine_view ( ) {
+
+#if defined ( __cpp_lib_ranges ) && defined ( __cpp_lib_span ) && defined ( __cpp_lib_coroutine )
+
+    const std::int64_t n = 500'000'000;
+
+    const auto to_double = [ ] ( std::uint64_t x ) { return ( x >> 11 ) * 0x1.0p-53; };
+
+    VOLATILE double acc = 0.0;
+
+    {
+        boost::random::splitmix64 gen ( 0xBE1C0467EBA5FAC1 );
+
+        std::int64_t cnt = n;
+        double sum = 0.0;
+
+        std::cout << "operator ( )      ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            while ( cnt-- )
+                sum += to_double ( gen ( ) );
+        }
+
+        acc += sum;
+    }
+
+    {
+        boost::random::splitmix64 gen ( 0xBE1C0467EBA5FAC1 );
+
+        double sum = 0.0;
+
+        std::cout << "engine_view       ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            for ( double d : boost::random::engine_view ( gen ) | std::views::transform ( to_double ) | std::views::take ( n ) )
+                sum += d;
+        }
+
+        acc += sum;
+    }
+
+    {
+        boost::random::splitmix64 gen ( 0xBE1C0467EBA5FAC1 );
+
+        double sum = 0.0;
+
+        std::cout << "engine_block_view ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            using view_type = boost::random::engine_block_view<boost::random::splitmix64>;
+
+            for ( view_type::block_type block : view_type ( gen ) | std::views::take ( n / view_type::block_size ) )
+                for ( double d : block | std::views::transform ( to_double ) )
+                    sum += d;
+        }
+
+        acc += sum;
+    }
+
+    {
+        boost::random::splitmix64 gen ( 0xBE1C0467EBA5FAC1 );
+
+        double sum = 0.0;
+
+        std::cout << "generate_values   ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            for ( double d : boost::random::generate_values ( gen ) | std::views::transform ( to_double ) | std::views::take ( n ) )
+                sum += d;
+        }
+
+        acc += sum;
+    }
+
+    {
+        boost::random::splitmix64 gen ( 0xBE1C0467EBA5FAC1 );
+
+        double sum = 0.0;
+
+        std::cout << "generate_blocks   ";
+
+        {
+            degski::AutoTimer t ( degski::milliseconds );
+
+            for ( auto block : boost::random::generate_blocks ( gen ) | std::views::take ( n / 512 ) )
+                for ( double d : block | std::views::transform ( to_double ) )
+                    sum += d;
+        }
+
+        acc += sum;
+    }
+
+#else
+
+    std::cout << "engine_view requires C++20 ranges and coroutines.\n";
+
+#endif
+
+    return 0;
+}
+
+
+template<typename Generator>
+void bench_binary_state ( const char * name_ ) {
+
+    const int n = 10'000;
+
+    boost::random::seed_seq seq { 1, 2, 3, 4 };
+    Generator gen ( seq ), restored;
+
+    VOLATILE std::size_t acc = 0;
+
+    std::cout << name_ << "text   ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( int i = 0; i < n; ++i ) {
+            std::stringstream ss;
+            ss << gen;
+            ss >> restored;
+            acc += ss.tellg ( );
+        }
+    }
+
+    std::vector<unsigned char> buffer ( boost::random::binary_state_size<Generator> ( ) );
+
+    std::cout << name_ << "binary ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( int i = 0; i < n; ++i ) {
+            acc += boost::random::save ( gen, buffer.data ( ), buffer.size ( ) );
+            boost::random::load ( restored, buffer.data ( ), buffer.size ( ) );
+        }
+    }
+}
+
+// The binary state of the engines round trips, and its layout is fixed:
+// the state of a splitmix64 seeded with 0 is 0, its gamma the golden
+// ratio, written as little endian 32-bit words whatever the build.
+
+template<typename Generator>
+bool binary_state_round_trip ( ) {
+    boost::random::seed_seq seq { 1, 2, 3, 4 };
+    Generator gen ( seq ), restored;
+    gen.discard ( 3 );
+    std::vector<unsigned char> buffer ( boost::random::binary_state_size<Generator> ( ) );
+    boost::random::save ( gen, buffer.data ( ), buffer.size ( ) );
+    boost::random::load ( restored, buffer.data ( ), buffer.size ( ) );
+    bool ok = true;
+    for ( int i = 0; i < 8; ++i )
+        ok = ok && restored ( ) == gen ( );
+    return ok;
+}
+
+bool binary_state_layout ( ) {
+    const unsigned char expected [ 16 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 0x15, 0x7C, 0x4A, 0x7F, 0xB9, 0x79, 0x37, 0x9E };
+    unsigned char buffer [ boost::random::binary_state_size<boost::random::splitmix64> ( ) ];
+    boost::random::save ( boost::random::splitmix64 ( 0 ), buffer, sizeof ( buffer ) );
+    return std::equal ( std::begin ( expected ), std::end ( expected ), buffer + sizeof ( buffer ) - 16 );
+}
+
+int main_binary_state ( ) {
+
+    const bool ok = binary_state_round_trip<boost::random::splitmix64> ( ) && binary_state_round_trip<boost::random::xoroshiro128plus> ( ) &&
+        binary_state_round_trip<boost::random::xoshiro256starstar> ( ) && binary_state_round_trip<boost::random::xorshift1024star> ( ) &&
+        binary_state_round_trip<boost::random::cmwc4096> ( ) && binary_state_round_trip<boost::random::taus88> ( ) &&
+        binary_state_round_trip<boost::random::lfsr113> ( ) && binary_state_layout ( );
+    std::cout << "binary state round trip " << std::boolalpha << ok << '\n';
+
+    bench_binary_state<boost::random::xorshift1024star> ( "xorshift1024star " );
+    bench_binary_state<boost::random::cmwc4096> ( "cmwc4096         " );
+
+    const std::size_t n = 1'000'000;
+
+    std::vector<boost::random::xoroshiro128plus> engines ( n );
+
+    boost::random::seed_seq seq { 1, 2, 3, 4 };
+    boost::random::seed_many ( seq, engines.data ( ), engines.data ( ) + n );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    std::cout << "save_engines     ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::save_engines ( "engines.bin", engines.data ( ), engines.data ( ) + n );
+    }
+
+    std::cout << "mapped_engines   ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        boost::random::mapped_engines<boost::random::xoroshiro128plus> restored ( "engines.bin" );
+
+        for ( std::size_t i = 0; i < restored.size ( ); ++i )
+            acc += restored [ i ] ( );
+    }
+
+    {
+        boost::random::mapped_engines<boost::random::xoroshiro128plus> restored ( "engines.bin" );
+        bool ok = restored.size ( ) == n;
+        for ( std::size_t i = 0; ok && i < n; ++i )
+            ok = restored [ i ] == engines [ i ];
+        std::cout << "mapped_engines equal " << std::boolalpha << ok << '\n';
+    }
+
+    std::remove ( "engines.bin" );
+
+    return 0;
+}
+
+
+int main_engine_bank ( ) {
+
+    const std::size_t n = 10'000'000, m = 1'000'000;
+    const int steps = 20;
+
+    boost::random::seed_seq seq { 1, 2, 3, 4 };
+
+    std::vector<boost::random::xoroshiro128plus> engines ( n );
+    boost::random::seed_many ( seq, engines.data ( ), engines.data ( ) + n );
+    boost::random::engine_bank<boost::random::xoroshiro128plus> bank ( n, seq );
+
+    std::vector<std::uint64_t> out ( n );
+    std::vector<std::uint32_t> indices ( n );
+    std::iota ( indices.begin ( ), indices.end ( ), 0u );
+    boost::random::xoroshiro128plus gen ( 0xBE1C0467EBA5FAC1 );
+    boost::random::shuffle ( indices.begin ( ), indices.end ( ), gen );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    std::cout << "vector step      ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( int s = 0; s < steps; ++s )
+            for ( std::size_t i = 0; i < n; ++i )
+                out [ i ] = engines [ i ] ( );
+    }
+
+    acc += out [ n / 2 ];
+
+    std::cout << "engine_bank step ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( int s = 0; s < steps; ++s )
+            bank.generate ( out.data ( ) );
+    }
+
+    acc += out [ n / 2 ];
+
+    std::cout << "vector indexed   ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( int s = 0; s < steps; ++s )
+            for ( std::size_t k = 0; k < m; ++k )
+                out [ k ] = engines [ indices [ k ] ] ( );
+    }
+
+    acc += out [ m / 2 ];
+
+    std::cout << "engine_bank idx  ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( int s = 0; s < steps; ++s )
+            bank.generate ( indices.data ( ), m, out.data ( ) );
+    }
+
+    acc += out [ m / 2 ];
+
+    return 0;
+}
+
+
+// The hooks of the engines compile to nothing unless
+// BOOST_RANDOM_INSTRUMENTATION is defined: build with and without it and
+// compare the timings. Without it the hooks expand to no tokens at all
+// (checked below), the engines compile to the code of a build without
+// the hooks; with it the engines stay usable in constant expressions
+// where the compiler has __builtin_is_constant_evaluated().
+
+#define INSTRUMENTATION_STRINGIZE(...) #__VA_ARGS__
+#define INSTRUMENTATION_EXPANDED(...) INSTRUMENTATION_STRINGIZE(__VA_ARGS__)
+
+#if !defined ( BOOST_RANDOM_INSTRUMENTATION )
+static_assert ( sizeof ( INSTRUMENTATION_EXPANDED ( BOOST_RANDOM_DETAIL_INSTRUMENT ( boost::random::xoroshiro128plus, values, 1 ) ) ) == 1,
+    "the hooks expand to nothing" );
+#endif
+
+#if defined ( BOOST_RANDOM_INSTRUMENTATION_CONSTEXPR )
+constexpr std::uint64_t instrumentation_constexpr_check ( ) {
+    boost::random::xoroshiro128plus gen ( 0xBE1C0467EBA5FAC1 );
+    gen.jump ( );
+    return gen ( );
+}
+
+static_assert ( instrumentation_constexpr_check ( ) != 0, "the engines are constexpr" );
+#endif
+
+int main_instrumentation ( ) {
+
+    const std::size_t n = 100'000'000;
+
+    std::cout << "instrumentation " << ( boost::random::instrumentation_enabled ? "enabled" : "disabled" ) << '\n';
+
+    boost::random::xoroshiro128plus gen ( 0xBE1C0467EBA5FAC1 );
+    boost::random::xoshiro256starstar gen256 ( 0xBE1C0467EBA5FAC1 );
+    boost::random::cmwc4096 cmwc ( 0xBE1C0467EBA5FAC1 );
+
+    std::vector<std::uint32_t> words ( 1024 );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    std::cout << "xoroshiro128plus  ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        std::uint64_t a = 0;
+        for ( std::size_t i = 0; i < n; ++i )
+            a += gen ( );
+        acc += a;
+    }
+
+    std::cout << "xoshiro256** bulk ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( std::size_t i = 0; i < n / words.size ( ); ++i ) {
+            gen256.generate ( words.begin ( ), words.end ( ) );
+            acc += words [ i & 1023 ];
+        }
+        gen256.long_jump ( );
+    }
+
+    std::cout << "cmwc4096          ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        std::uint64_t a = 0;
+        for ( std::size_t i = 0; i < n; ++i )
+            a += cmwc ( );
+        acc += a;
+    }
+
+    gen.jump ( 3 );
+    cmwc.seed ( 42u );
+
+    for ( const boost::random::engine_statistics & s : boost::random::instrumentation_snapshot ( ) )
+        std::cout << s.name << " values " << s.counters.values << " bulk " << s.counters.bulk_calls << " jumps " << s.counters.jumps << " reseeds " << s.counters.reseeds << '\n';
+
+    return 0;
+}
+
+
+template<typename G>
+void quality_monitor_detection ( const char * name ) {
+
+    std::cout << name << '\n';
+
+    {
+        boost::random::quality_monitor monitor ( [ ] ( const boost::random::quality_monitor::alert & a ) {
+            std::cout << "  alert: " << ( a.test == boost::random::quality_monitor::binary_rank ? "binary rank" : "bit frequency" ) << " bit " << a.bit << " statistic " << a.statistic << '\n';
+        }, 1024 );
+        boost::random::monitored_engine<G> gen ( G ( 0xBE1C0467EBA5FAC1 ), monitor, 1024 );
+
+        std::vector<std::uint32_t> words ( 2048 );
+
+        // 1024 chunks, 4 binary rank matrices per bit.
+        for ( int i = 0; i < 1024; ++i ) {
+            gen.generate ( words.begin ( ), words.end ( ) );
+            if ( ( i & 63 ) == 63 )
+                std::this_thread::sleep_for ( std::chrono::milliseconds ( 50 ) );
+        }
+
+        while ( monitor.stats ( ).chunks + monitor.stats ( ).dropped < 1024 )
+            std::this_thread::sleep_for ( std::chrono::milliseconds ( 1 ) );
+
+        const boost::random::quality_monitor::statistics s = monitor.stats ( );
+        std::cout << "  chunks " << s.chunks << " dropped " << s.dropped << " matrices " << s.matrices << " rank failures " << s.rank_failures << " max z " << s.max_frequency_z << " (bit " << s.max_frequency_bit << ")\n";
+    }
+}
+
+int main_quality_monitor ( ) {
+
+    const std::size_t n = 100'000;
+
+    std::vector<std::uint32_t> words ( 1024 );
+
+    VOLATILE std::uint64_t acc = 0;
+
+    boost::random::quality_monitor monitor ( nullptr );
+
+    boost::random::xoroshiro128plus plain ( 0xBE1C0467EBA5FAC1 );
+    boost::random::monitored_engine<boost::random::xoroshiro128plus> monitored ( plain, monitor );
+
+    std::cout << "generate           ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( std::size_t i = 0; i < n; ++i ) {
+            plain.generate ( words.begin ( ), words.end ( ) );
+            acc += words [ i & 1023 ];
+        }
+    }
+
+    std::cout << "monitored generate ";
+
+    {
+        degski::AutoTimer t ( degski::milliseconds );
+
+        for ( std::size_t i = 0; i < n; ++i ) {
+            monitored.generate ( words.begin ( ), words.end ( ) );
+            acc += words [ i & 1023 ];
+        }
+    }
+
+    quality_monitor_detection<boost::random::xoroshiro128plus> ( "xoroshiro128plus" );
+    quality_monitor_detection<boost::random::xoroshiro128plusshixo> ( "xoroshiro128plusshixo" );
+    quality_monitor_detection<boost::random::xoshiro256starstar> ( "xoshiro256starstar" );
+
+    return 0;
+}
+
+
 int main436463466 ( ) {
 
     std::seed_seq seq { INT32_MAX, 3466, 456454, 23423 };
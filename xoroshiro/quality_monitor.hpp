@@ -0,0 +1,389 @@
+/* boost random/quality_monitor.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_QUALITY_MONITOR_HPP
+#define BOOST_RANDOM_QUALITY_MONITOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/align/aligned_allocator.hpp>
+
+#include "bounded_ring.hpp"
+#include "buffered_engine.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * Transposes the 64 x 64 bit matrix a in place: bit i of a[b] becomes
+     * bit b of a[i] (Hacker's Delight, 7-3).
+     */
+    inline void transpose_bits(std::uint64_t* a)
+    {
+        std::uint64_t m = 0x00000000FFFFFFFF;
+        for (unsigned j = 32; j; j >>= 1, m ^= m << j) {
+            for (unsigned k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+                const std::uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+                a[k | j] ^= t;
+                a[k] ^= t << j;
+            }
+        }
+    }
+
+    /**
+     * Returns the rank over GF(2) of the rows x Words * 64 bit matrix m,
+     * Gaussian elimination in place.
+     */
+    template<std::size_t Words>
+    inline std::size_t gf2_rank(std::uint64_t (*m)[Words], std::size_t rows)
+    {
+        std::size_t rank = 0;
+        for (std::size_t col = 0; col < Words * 64 && rank < rows; ++col) {
+            const std::size_t w = col / 64;
+            const std::uint64_t bit = std::uint64_t { 1 } << (col % 64);
+            std::size_t pivot = rank;
+            while (pivot < rows && !(m[pivot][w] & bit)) {
+                ++pivot;
+            }
+            if (pivot == rows) {
+                continue;
+            }
+            if (pivot != rank) {
+                for (std::size_t k = 0; k < Words; ++k) {
+                    const std::uint64_t t = m[rank][k];
+                    m[rank][k] = m[pivot][k], m[pivot][k] = t;
+                }
+            }
+            for (std::size_t r = rank + 1; r < rows; ++r) {
+                if (m[r][w] & bit) {
+                    for (std::size_t k = w; k < Words; ++k) {
+                        m[r][k] ^= m[rank][k];
+                    }
+                }
+            }
+            ++rank;
+        }
+        return rank;
+    }
+
+} // namespace detail
+
+/**
+ * A quality_monitor tests samples of the output of live engines in a
+ * thread of its own, a chunk of @c chunk_size consecutive 64-bit values
+ * at a time, and raises an alert if they stop looking random:
+ *
+ * - bit frequency: the number of ones of each of the 64 bit positions,
+ *   over all chunks, is tested for a deviation of more than
+ *   frequency_threshold standard deviations;
+ * - binary rank: each chunk gives a row of chunk_size bits per bit
+ *   position (the bit of the consecutive values), chunk_size rows make a
+ *   square matrix whose rank over GF(2) is computed. A random matrix
+ *   falls short of full rank by more than rank_slack with a probability
+ *   below 10^-10, the lowest bit of xoroshiro128plus (a linear
+ *   recurrence of 128 bits) gives a rank of at most 128, the failure of
+ *   PractRand's [Low1/64]BRank.
+ *
+ * The chunks are handed over through a lock-free bounded ring (Vyukov's
+ * multi-producer queue), a chunk is dropped (and counted) if the ring is
+ * full, so a producer never waits. An alert is raised once per test and
+ * bit position, by a call of the handler on the thread of the monitor.
+ *
+ * Chunks are fed by monitored_engine or by push(). The monitor must
+ * outlive its producers.
+ */
+class quality_monitor
+{
+public:
+    /** The number of consecutive values of a chunk. */
+    BOOST_STATIC_CONSTANT(std::size_t, chunk_size = 256);
+
+    /** The bit frequency test fails beyond this many standard deviations. */
+    static BOOST_CONSTEXPR double frequency_threshold() { return 6.0; }
+
+    /** The binary rank test fails if the rank is below chunk_size - rank_slack. */
+    BOOST_STATIC_CONSTANT(std::size_t, rank_slack = 5);
+
+    enum test_type { bit_frequency, binary_rank };
+
+    /** An alert, @c statistic is the z-score or the rank. */
+    struct alert
+    {
+        test_type test;
+        unsigned bit;
+        double statistic;
+    };
+
+    /** The counters of the monitor, totals since construction. */
+    struct statistics
+    {
+        /** The number of chunks tested. */
+        std::uint64_t chunks;
+        /** The number of chunks dropped, the ring being full. */
+        std::uint64_t dropped;
+        /** The number of binary rank tests and of their failures. */
+        std::uint64_t matrices, rank_failures;
+        /** The largest absolute z-score of the bit frequencies, and its bit. */
+        double max_frequency_z;
+        unsigned max_frequency_bit;
+    };
+
+    typedef std::function<void(const alert&)> handler_type;
+
+    /**
+     * Starts the monitor on a ring of @c chunks chunks (rounded up to a
+     * power of 2), @c handler is called on alerts.
+     */
+    explicit quality_monitor(handler_type handler, std::size_t chunks = 64)
+      : _ring(chunks), _handler(handler), _ones(), _rows(0), _alerted(), _stats()
+    {
+        _dropped.store(0, std::memory_order_relaxed);
+        _stop.store(false, std::memory_order_relaxed);
+        _matrices.resize(64 * chunk_size * row_words);
+        _thread = std::thread(&quality_monitor::run, this);
+    }
+
+    quality_monitor(const quality_monitor&) = delete;
+    quality_monitor& operator=(const quality_monitor&) = delete;
+
+    /** Tests the chunks left in the ring and joins the thread. */
+    ~quality_monitor()
+    {
+        _stop.store(true, std::memory_order_release);
+        _thread.join();
+    }
+
+    /**
+     * Copies the chunk_size consecutive values at @c chunk into the ring,
+     * false (and counts a dropped chunk) if it is full.
+     */
+    bool push(const std::uint64_t* chunk)
+    {
+        if (!_ring.push(chunk)) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /** Returns the counters of the monitor. */
+    statistics stats() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        statistics s = _stats;
+        s.dropped = _dropped.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    /// \cond show_private
+
+    static const std::size_t row_words = chunk_size / 64;
+
+    typedef std::uint64_t row_type[row_words];
+
+    void run()
+    {
+        std::vector<std::uint64_t, boost::alignment::aligned_allocator<std::uint64_t, 64> > chunk(chunk_size);
+        for (;;) {
+            if (_ring.pop(chunk.data())) {
+                test(chunk.data());
+            }
+            else if (_stop.load(std::memory_order_acquire)) {
+                // The producers are gone, the ring is drained.
+                return;
+            }
+            else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    void test(const std::uint64_t* chunk)
+    {
+        row_type* rows = reinterpret_cast<row_type*>(_matrices.data());
+        for (std::size_t w = 0; w < row_words; ++w) {
+            std::uint64_t bits[64];
+            std::memcpy(bits, chunk + w * 64, sizeof(bits));
+            detail::transpose_bits(bits);
+            for (unsigned b = 0; b < 64; ++b) {
+                rows[b * chunk_size + _rows][w] = bits[b];
+                _ones[b] += static_cast<std::uint64_t>(popcount(bits[b]));
+            }
+        }
+        std::vector<alert> alerts;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_stats.chunks;
+            // The number of ones of a bit is binomial(n, 1/2).
+            const double n = static_cast<double>(_stats.chunks * chunk_size);
+            _stats.max_frequency_z = 0.0;
+            for (unsigned b = 0; b < 64; ++b) {
+                const double z = std::fabs((static_cast<double>(_ones[b]) - n / 2) / std::sqrt(n / 4));
+                if (z > _stats.max_frequency_z) {
+                    _stats.max_frequency_z = z, _stats.max_frequency_bit = b;
+                }
+                if (z > frequency_threshold() && !_alerted[bit_frequency][b]) {
+                    _alerted[bit_frequency][b] = true;
+                    const alert a = { bit_frequency, b, z };
+                    alerts.push_back(a);
+                }
+            }
+            if (++_rows == chunk_size) {
+                _rows = 0;
+                for (unsigned b = 0; b < 64; ++b) {
+                    const std::size_t rank = detail::gf2_rank(rows + b * chunk_size, chunk_size);
+                    ++_stats.matrices;
+                    if (rank + rank_slack < chunk_size) {
+                        ++_stats.rank_failures;
+                        if (!_alerted[binary_rank][b]) {
+                            _alerted[binary_rank][b] = true;
+                            const alert a = { binary_rank, b, static_cast<double>(rank) };
+                            alerts.push_back(a);
+                        }
+                    }
+                }
+            }
+        }
+        if (_handler) {
+            for (std::size_t i = 0; i < alerts.size(); ++i) {
+                _handler(alerts[i]);
+            }
+        }
+    }
+
+    static int popcount(std::uint64_t x)
+    {
+#if defined(__GNUC__)
+        return __builtin_popcountll(x);
+#else
+        int n = 0;
+        for (; x; x &= x - 1) {
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    detail::bounded_ring<std::uint64_t, chunk_size> _ring;
+    handler_type _handler;
+
+    // Written by the thread of the monitor only.
+    std::vector<std::uint64_t> _matrices;
+    std::uint64_t _ones[64];
+    std::size_t _rows;
+    bool _alerted[2][64];
+
+    mutable std::mutex _mutex;
+    statistics _stats;
+    std::thread _thread;
+
+    BOOST_ALIGNMENT(64) std::atomic<std::uint64_t> _dropped;
+    std::atomic<bool> _stop;
+
+    /// \endcond
+};
+
+/**
+ * A monitored_engine is an engine that feeds a quality_monitor with
+ * samples of its output. After every @c interval values written by
+ * generate(), the next chunk_size values of the engine are drawn from a
+ * copy of it with its bulk generation (as buffered_engine) and pushed to
+ * the monitor: the chunk is the output the engine returns next, the
+ * stream is unchanged. The interval counts the elements written by
+ * generate(), the 32-bit words of generate_from_int() for the engines of
+ * the library: with the default interval of 2^20 a chunk of 256 values
+ * is drawn every 2^19 values, the sampling draws about 0.05% more
+ * values, and a binary rank test completes every 2^27 values.
+ * operator() is not sampled.
+ *
+ * A 32-bit engine gives 64-bit values from pairs of outputs (the first
+ * in the low word).
+ */
+template<class Engine>
+class monitored_engine
+{
+public:
+    typedef Engine base_type;
+    typedef typename base_type::result_type result_type;
+
+    monitored_engine(const base_type& eng, quality_monitor& monitor, std::size_t interval = std::size_t { 1 } << 20)
+      : _eng(eng), _monitor(&monitor), _interval(static_cast<std::ptrdiff_t>(interval)), _countdown(static_cast<std::ptrdiff_t>(interval))
+    {
+        BOOST_ASSERT(interval > 0);
+    }
+
+    /** Returns the next value of the engine. */
+    result_type operator()() { return _eng(); }
+
+    /** Fills a range with random values and samples the engine when due. */
+    template<class Iter>
+    void generate(Iter first, Iter last)
+    {
+        const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(std::distance(first, last));
+        _eng.generate(first, last);
+        if (BOOST_UNLIKELY((_countdown -= n) <= 0)) {
+            sample();
+        }
+    }
+
+    /** Advances the state of the engine by @c z. */
+    void discard(std::uintmax_t z) { _eng.discard(z); }
+
+    /** Returns the engine. */
+    base_type& base() { return _eng; }
+    const base_type& base() const { return _eng; }
+
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (base_type::min)(); }
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (base_type::max)(); }
+
+private:
+    /// \cond show_private
+
+    BOOST_NOINLINE void sample()
+    {
+        BOOST_ALIGNMENT(64) std::uint64_t chunk[quality_monitor::chunk_size];
+        base_type eng(_eng);
+        detail::fill_results(eng, chunk, quality_monitor::chunk_size);
+        _monitor->push(chunk);
+        _countdown = _interval;
+    }
+
+    base_type _eng;
+    quality_monitor* _monitor;
+    std::ptrdiff_t _interval, _countdown;
+
+    /// \endcond
+};
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_QUALITY_MONITOR_HPP
@@ -0,0 +1,292 @@
+/* boost random/seed_many.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_SEED_MANY_HPP
+#define BOOST_RANDOM_SEED_MANY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#endif
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "xoroshiro.hpp"
+
+namespace boost {
+namespace random {
+
+#if !defined(BOOST_NO_INT64_T) && !defined(BOOST_NO_INTEGRAL_INT64_T)
+
+namespace detail {
+
+    template<class Engine>
+    struct engine_access
+    {
+        static std::uint64_t* state(Engine& e) noexcept
+        { return e._s; }
+
+        static constexpr std::size_t state_size()
+        { return sizeof(Engine::_s) / sizeof(std::uint64_t); }
+
+        // As the SeedSeq seed(), which starts a xorshift1024star at _p = 0.
+        static void rewind(Engine&) noexcept { }
+
+        static void warmup(Engine& e) noexcept
+        { e.warmup(); }
+
+        // Returns the engine with state (s0, s1), for the xoroshiro128
+        // engines only.
+        static Engine make(std::uint64_t s0, std::uint64_t s1) noexcept
+        { return Engine(engine_state_tag(), s0, s1); }
+    };
+
+    template<>
+    inline void engine_access<xorshift1024star>::rewind(xorshift1024star& e) noexcept
+    { e._p = 0; }
+
+    /**
+     * Runs warmup() on the engines in [first, last), the primary template
+     * warms up the engines one by one.
+     */
+    template<class Engine, class Enable = void>
+    struct bulk_warmup
+    {
+        static void apply(Engine* first, Engine* last) noexcept
+        {
+            for (; first != last; ++first) {
+                engine_access<Engine>::warmup(*first);
+            }
+        }
+    };
+
+#if defined(__AVX2__)
+
+    inline __m256i rotl_epi64(__m256i x, int k) noexcept
+    {
+        return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+    }
+
+    // Gathers word i of the states of 4 engines into the lanes of a register.
+    template<class Engine>
+    inline __m256i load_lanes(Engine* e, std::size_t i) noexcept
+    {
+        typedef engine_access<Engine> access;
+        return _mm256_set_epi64x(
+            static_cast<long long>(access::state(e[3])[i]), static_cast<long long>(access::state(e[2])[i]),
+            static_cast<long long>(access::state(e[1])[i]), static_cast<long long>(access::state(e[0])[i]));
+    }
+
+    template<class Engine>
+    inline void store_lanes(Engine* e, std::size_t i, __m256i x) noexcept
+    {
+        typedef engine_access<Engine> access;
+        BOOST_ALIGNMENT(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), x);
+        for (std::size_t l = 0; l < 4; ++l) {
+            access::state(e[l])[i] = lanes[l];
+        }
+    }
+
+    /**
+     * The 8 step warmup() of the xoroshiro128 engines, 4 engines at a
+     * time, one per lane.
+     */
+    template<class Engine>
+    struct xoroshiro128_bulk_warmup
+    {
+        static void apply(Engine* first, Engine* last) noexcept
+        {
+            for (; last - first >= 4; first += 4) {
+                __m256i s0 = load_lanes(first, 0), s1 = load_lanes(first, 1);
+                for (int step = 0; step < 8; ++step) {
+                    s1 = _mm256_xor_si256(s1, s0);
+                    s0 = _mm256_xor_si256(_mm256_xor_si256(rotl_epi64(s0, 55), s1),
+                                          _mm256_slli_epi64(s1, 14));
+                    s1 = rotl_epi64(s1, 36);
+                }
+                store_lanes(first, 0, s0), store_lanes(first, 1, s1);
+            }
+            bulk_warmup<Engine, int>::apply(first, last);
+        }
+    };
+
+    /**
+     * The 8 step warmup() of the xoshiro256 engines, 4 engines at a
+     * time, one per lane.
+     */
+    template<class Engine>
+    struct xoshiro256_bulk_warmup
+    {
+        static void apply(Engine* first, Engine* last) noexcept
+        {
+            for (; last - first >= 4; first += 4) {
+                __m256i s0 = load_lanes(first, 0), s1 = load_lanes(first, 1),
+                        s2 = load_lanes(first, 2), s3 = load_lanes(first, 3);
+                for (int step = 0; step < 8; ++step) {
+                    const __m256i t = _mm256_slli_epi64(s1, 17);
+                    s2 = _mm256_xor_si256(s2, s0);
+                    s3 = _mm256_xor_si256(s3, s1);
+                    s1 = _mm256_xor_si256(s1, s2);
+                    s0 = _mm256_xor_si256(s0, s3);
+                    s2 = _mm256_xor_si256(s2, t);
+                    s3 = rotl_epi64(s3, 45);
+                }
+                store_lanes(first, 0, s0), store_lanes(first, 1, s1);
+                store_lanes(first, 2, s2), store_lanes(first, 3, s3);
+            }
+            bulk_warmup<Engine, int>::apply(first, last);
+        }
+    };
+
+    // bulk_warmup<Engine, int> is the (scalar) primary template, used for
+    // the remainder.
+    template<> struct bulk_warmup<xoroshiro128plus> : xoroshiro128_bulk_warmup<xoroshiro128plus> { };
+    template<> struct bulk_warmup<xoroshiro128plusshixo> : xoroshiro128_bulk_warmup<xoroshiro128plusshixo> { };
+    template<> struct bulk_warmup<xoroshiro128plusshixostar> : xoroshiro128_bulk_warmup<xoroshiro128plusshixostar> { };
+    template<> struct bulk_warmup<xoroshiro128plusshixostarshixo> : xoroshiro128_bulk_warmup<xoroshiro128plusshixostarshixo> { };
+    template<> struct bulk_warmup<xoshiro256starstar> : xoshiro256_bulk_warmup<xoshiro256starstar> { };
+    template<> struct bulk_warmup<xoshiro256plus> : xoshiro256_bulk_warmup<xoshiro256plus> { };
+
+#endif
+
+    // The number of 32-bit words of seed material drawn from a SeedSeq
+    // by seed_many_states(), the size of its buffer (4 KB, on the stack).
+    const std::size_t seed_many_block_words = 1024;
+
+    /**
+     * Computes the states of @c count engines of @c n 64-bit words from
+     * @c seq and passes them to @c put(i, s), s pointing at the n words of
+     * engine i, see seed_many(). The states are computed a block at a time,
+     * @c seq.generate() filling the same fixed size buffer for each block,
+     * nothing is allocated.
+     */
+    template<class SeedSeq, class Put>
+    void seed_many_states(SeedSeq& seq, std::size_t n, std::size_t count, Put put)
+    {
+        BOOST_ASSERT(n <= 16);
+        const std::size_t block = seed_many_block_words / (2 * n);
+        std::uint_least32_t words[seed_many_block_words];
+
+        bool have_seed = false;
+        std::uint64_t seed = 0;
+        std::uint64_t s[16];
+        for (std::size_t first = 0, b = 0; first < count; first += block, ++b) {
+            const std::size_t m = count - first < block ? count - first : block;
+            seq.generate(words, words + 2 * n * m);
+            for (std::size_t p = 0; p < m; ++p) {
+                const std::size_t i = first + p;
+                std::uint64_t any = 0;
+                for (std::size_t j = 0; j < n; ++j) {
+                    s[j] = (static_cast<std::uint64_t>(words[2 * (p * n + j) + 1]) << 32)
+                        + static_cast<std::uint64_t>(words[2 * (p * n + j)]);
+                    if (b) {
+                        // A deterministic SeedSeq gives every block the
+                        // same words, set the blocks apart with a
+                        // non-linear bijection keyed by the block.
+                        s[j] = xoroshiro_integer_hash(s[j] + splitmix64::at(b, p * n + j));
+                    }
+                    any |= s[j];
+                }
+                if (!any) {
+                    // Fix zeros, values [i * n, (i + 1) * n) of a splitmix64
+                    // seeded from seq.param().
+                    if (!have_seed) {
+                        int shift = 32;
+                        seq.param(param_hash_iterator(seed, shift));
+                        have_seed = true;
+                    }
+                    for (std::size_t j = 0; j < n; ++j) {
+                        s[j] = splitmix64::at(seed, i * n + j);
+                    }
+                }
+                put(i, static_cast<const std::uint64_t*>(s));
+            }
+        }
+    }
+
+    // Stores the states of seed_many_states() in the engines.
+    template<class Engine>
+    struct seed_many_put
+    {
+        Engine* first;
+
+        void operator()(std::size_t i, const std::uint64_t* s) const
+        {
+            typedef engine_access<Engine> access;
+            std::uint64_t* state = access::state(first[i]);
+            for (std::size_t j = 0; j < access::state_size(); ++j) {
+                state[j] = s[j];
+            }
+            access::rewind(first[i]);
+        }
+    };
+
+} // namespace detail
+
+/**
+ * Seeds the engines in [first, last) from @c seq, a block of up to
+ * B = 512 / n engines at a time (n being the number of 64-bit words of
+ * the state of an engine). Each block takes its seed material from a call
+ * to @c seq.generate() of 2 * n * m words, m being the number of engines
+ * of the block, engine p of the block receiving the 32-bit words
+ * [2 * p * n, 2 * (p + 1) * n): @c seq.generate() is not re-run per engine
+ * (which would give all engines the same state). The words of the engines
+ * of block b > 0 are added to the values [p * n, (p + 1) * n) of
+ * @c splitmix64::at(b, .) and hashed, as a SeedSeq whose output only
+ * depends on the length of the range (as seed_seq_fe, std::seed_seq) gives
+ * all full blocks the same words. The seeding does not allocate, whatever
+ * the number of engines.
+ *
+ * All-zero states are replaced independently of each other, engine i by
+ * the values [i * n, (i + 1) * n) of a splitmix64 seeded from
+ * @c seq.param() as the SeedSeq seed() of the engines does. Engine 0 gets
+ * the state its SeedSeq seed() would give it if the output of
+ * @c seq.generate() does not depend on the length of the range (as
+ * seed_seq_fe), or if it is the only engine: the output of
+ * std::seed_seq::generate() does depend on it. The warmup of the engines
+ * runs on 4 engines at a time in AVX2 builds.
+ *
+ * Engine is one of the engines of xoroshiro.hpp, excluding splitmix64.
+ */
+template<class SeedSeq, class Engine>
+void seed_many(SeedSeq& seq, Engine* first, Engine* last)
+{
+    const detail::seed_many_put<Engine> put = { first };
+    detail::seed_many_states(seq, detail::engine_access<Engine>::state_size(),
+                             static_cast<std::size_t>(last - first), put);
+    detail::bulk_warmup<Engine>::apply(first, last);
+}
+
+#if defined(__cpp_lib_span)
+/** Seeds the engines of @c engines, see seed_many(seq, first, last). */
+template<class SeedSeq, class Engine>
+void seed_many(SeedSeq& seq, std::span<Engine> engines)
+{
+    seed_many(seq, engines.data(), engines.data() + engines.size());
+}
+#endif
+
+#endif /* !BOOST_NO_INT64_T && !BOOST_NO_INTEGRAL_INT64_T */
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_SEED_MANY_HPP
@@ -79,6 +79,10 @@
  * mix_entropy(). Furthermore there were some minor changes like boostifications,
  * privatization of some public functions and some re-formatting.
  *
+ * To allow construction (and generation) at compile time, the static_vector
+ * was subsequently replaced by a plain array and a flag recording whether the
+ * sequence is empty, and all construction and generation is constexpr (C++14).
+ *
  */
 
 #ifndef BOOST_RANDOM_SEED_SEQ_FE_HPP
@@ -90,8 +94,11 @@
 #include <algorithm>
 #include <iterator>
 
+#include <array>
+#include <type_traits>
+#include <utility>
+
 #include <boost/config.hpp>
-#include <boost/container/static_vector.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 
@@ -99,12 +106,31 @@
 #include <initializer_list>
 #endif
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #if __cpp_constexpr >= 201304L
     #define SEED_SEQ_FE_GENERALIZED_CONSTEXPR constexpr
 #else
     #define SEED_SEQ_FE_GENERALIZED_CONSTEXPR
 #endif
 
+#if defined(__cpp_lib_array_constexpr) && __cpp_lib_array_constexpr >= 201603L
+    #define SEED_SEQ_FE_ARRAY_CONSTEXPR constexpr
+#else
+    #define SEED_SEQ_FE_ARRAY_CONSTEXPR
+#endif
+
+// True during constant evaluation, used to avoid the SIMD paths at compile time.
+#if defined(__cpp_lib_is_constant_evaluated)
+    #define SEED_SEQ_FE_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+    #define SEED_SEQ_FE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+    #define SEED_SEQ_FE_IS_CONSTANT_EVALUATED() false
+#endif
+
 
 namespace boost {
 namespace random {
@@ -202,30 +228,75 @@ private:
         return result;
     }
 
+    static constexpr IntRep hash(IntRep value, IntRep xor_const, IntRep mult_const)
+    {
+        return ((value ^ xor_const) * mult_const)
+            ^ (((value ^ xor_const) * mult_const) >> XSHIFT);
+    }
+
+    static constexpr IntRep mix(IntRep x, IntRep y)
+    {
+        return (MIX_MULT_L*x - MIX_MULT_R*y)
+            ^ ((MIX_MULT_L*x - MIX_MULT_R*y) >> XSHIFT);
+    }
+
+    /**
+     * The hash constants INIT_A * MULT_A^t, t in [0, count * count], used
+     * by mix_entropy(). Filling and mixing the store takes count * count
+     * hashes, independent of the input, tabulating the constants removes
+     * the serial hash_const *= MULT_A dependency from those loops. Only
+     * tabulated for the usual (small) sizes.
+     */
+    static constexpr bool tabulated = count <= 16;
+
+    struct mix_constants {
+        SEED_SEQ_FE_GENERALIZED_CONSTEXPR mix_constants() : value()
+        {
+            IntRep hash_const = INIT_A;
+            for (std::size_t t = 0; t < sizeof(value) / sizeof(IntRep); ++t) {
+                value[t] = hash_const;
+                hash_const *= MULT_A;
+            }
+        }
+
+        IntRep value[tabulated ? count * count + 1 : 1];
+    };
+
+    static constexpr mix_constants constants {};
+
     /** Initializes the sequence from an iterator range. */
     template <typename InputIter>
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
     void mix_entropy(InputIter begin, InputIter end);
 
+    /** Scalar generate, usable at compile time. */
+    template <typename RandomAccessIterator>
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
+    void generate_scalar(RandomAccessIterator dest, RandomAccessIterator dest_end,
+                         std::size_t src, IntRep hash_const) const;
+
 public:
     seed_seq_fe(const seed_seq_fe&)     = delete;
     void operator=(const seed_seq_fe&)  = delete;
 
     /** Initializes a seed_seq to hold an empty sequence. */
-    seed_seq_fe(){}
+    constexpr seed_seq_fe() : _mixer(), _empty(true) {}
 
 #ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
     template <typename T>
-    seed_seq_fe ( std::initializer_list<T> init )
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
+    seed_seq_fe ( std::initializer_list<T> init ) : _mixer(), _empty(true)
     { seed(init.begin(), init.end()); }
 #endif
 
     template <typename InputIter>
-    seed_seq_fe(InputIter begin, InputIter end)
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
+    seed_seq_fe(InputIter begin, InputIter end) : _mixer(), _empty(true)
     { seed(begin, end); }
 
     /** Initializes the sequence from Boost.Range range. */
     template<class Range>
-    explicit seed_seq_fe(const Range& range)
+    explicit seed_seq_fe(const Range& range) : _mixer(), _empty(true)
     { seed(boost::begin(range), boost::end(range)); }
 
     /**
@@ -233,18 +304,37 @@ public:
      *
      * Requires: Iter must be a Random Access Iterator whose value type
      * is an integral type at least 32 bits wide.
+     *
+     * Does not throw, unless assigning through the iterator does.
      */
     template <typename RandomAccessIterator>
-    void generate(RandomAccessIterator first, RandomAccessIterator last) const;
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
+    void generate(RandomAccessIterator first, RandomAccessIterator last) const
+        noexcept(noexcept(*std::declval<RandomAccessIterator&>() = IntRep()));
+
+    /**
+     * Returns @c n 32-bit values based on the stored sequence, i.e. the
+     * values @c generate(first, first + n) would produce.
+     */
+    template <std::size_t n>
+    SEED_SEQ_FE_ARRAY_CONSTEXPR
+    std::array<result_type, n> generate() const
+    {
+        std::array<result_type, n> data {};
+        generate_scalar(data.begin(), data.end(), 0, INIT_B);
+        return data;
+    }
 
     static constexpr std::size_t size()
     { return count; }
 
     template <typename OutputIterator>
-    void param(OutputIterator dest) const;
+    void param(OutputIterator dest) const
+        noexcept(noexcept(*std::declval<OutputIterator&>() = IntRep()));
 
 private:
     template <typename InputIter>
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
     void seed(InputIter begin, InputIter end)
     {
         mix_entropy(begin, end);
@@ -254,120 +344,215 @@ private:
             stir();
     }
 
+    SEED_SEQ_FE_GENERALIZED_CONSTEXPR
     seed_seq_fe& stir()
     {
-        mix_entropy(_mixer.begin(), _mixer.end());
+        mix_entropy(_mixer, _mixer + count);
         return *this;
     }
 
-    boost::container::static_vector<IntRep, count> _mixer;
+#if defined(__AVX2__)
+    /** Generates 16 words per step, requires at least 16 words. */
+    template <typename RandomAccessIterator>
+    void generate_simd(RandomAccessIterator dest_begin,
+                       RandomAccessIterator dest_end) const;
+
+    /** Hashes 8 words, k0 and k1 are the xor- and multiply-constants. */
+    static __m256i hash_block(__m256i data, __m256i k0, __m256i k1)
+    {
+        data = _mm256_mullo_epi32(_mm256_xor_si256(data, k0), k1);
+        return _mm256_xor_si256(data, _mm256_srli_epi32(data, XSHIFT));
+    }
+#endif
+
+    IntRep _mixer[count];
+    bool _empty;
 };
 
+#if __cplusplus < 201703L
+template <std::size_t count, std::size_t mix_rounds>
+constexpr typename seed_seq_fe<count, mix_rounds>::mix_constants
+seed_seq_fe<count, mix_rounds>::constants;
+#endif
+
 template <std::size_t count, std::size_t r>
 template <typename InputIter>
+SEED_SEQ_FE_GENERALIZED_CONSTEXPR
 void seed_seq_fe<count, r>::mix_entropy(InputIter begin, InputIter end)
 {
+    // Fill the store (from the input or with zeros), this takes the first
+    // count hash constants.
     auto hash_const = INIT_A;
-    auto hash = [&](IntRep value) {
-        value ^= hash_const;
-        hash_const *= MULT_A;
-        value *= hash_const;
-        value ^= value >> XSHIFT;
-        return value;
-    };
-    auto mix = [](IntRep x, IntRep y) {
-        IntRep result = MIX_MULT_L*x - MIX_MULT_R*y;
-        result ^= result >> XSHIFT;
-        return result;
-    };
-
     InputIter current = begin;
-    if (_mixer.empty()) {
-        while (current != end && _mixer.size() < _mixer.static_capacity)
-            _mixer.emplace_back(hash(*current++));
-        while (_mixer.size() < _mixer.static_capacity)
-            _mixer.emplace_back(hash(0U));
+    for (std::size_t i = 0; i < count; ++i) {
+        const IntRep value = current != end ? IntRep(*current++) : IntRep(0U);
+        const IntRep xor_const = hash_const;
+        hash_const *= MULT_A;
+        _mixer[i] = hash(value, xor_const, hash_const);
+    }
+    _empty = false;
+
+    if (tabulated) {
+        // All count - 1 hashes of a source use their own (tabulated)
+        // constant, i.e. they are independent, the loops have compile-time
+        // trip counts and are unrolled for the seed_seq_fe128/seed_seq_fe256
+        // sizes.
+        const IntRep* const hash_consts = constants.value;
+        std::size_t t = count;
+        for (std::size_t src = 0; src < count; ++src, t += count - 1)
+            for (std::size_t dest = 0; dest < count; ++dest)
+                if (src != dest) {
+                    const std::size_t i = t + dest - (dest > src);
+                    _mixer[dest] = mix(_mixer[dest], hash(_mixer[src],
+                        hash_consts[i], hash_consts[i + 1]));
+                }
+        hash_const = hash_consts[count * count];
     }
     else {
-        for (auto& elem : _mixer) {
-            if (current != end)
-                elem = hash(*current++);
-            else
-                elem = hash(0U);
-        }
+        for (std::size_t src = 0; src < count; ++src)
+            for (std::size_t dest = 0; dest < count; ++dest)
+                if (src != dest) {
+                    const IntRep xor_const = hash_const;
+                    hash_const *= MULT_A;
+                    _mixer[dest] = mix(_mixer[dest],
+                        hash(_mixer[src], xor_const, hash_const));
+                }
     }
 
-    for (auto& src : _mixer)
-        for (auto& dest : _mixer)
-            if (&src != &dest)
-                dest = mix(dest,hash(src));
-    for (; current != end; ++current)
-        for (auto& dest : _mixer)
-            dest = mix(dest,hash(*current));
+    for (; current != end; ++current) {
+        for (std::size_t dest = 0; dest < count; ++dest) {
+            const IntRep xor_const = hash_const;
+            hash_const *= MULT_A;
+            _mixer[dest] = mix(_mixer[dest],
+                hash(IntRep(*current), xor_const, hash_const));
+        }
+    }
 }
 
 template <std::size_t count, std::size_t mix_rounds>
 template <typename OutputIterator>
 void seed_seq_fe<count, mix_rounds>::param(OutputIterator dest) const
+        noexcept(noexcept(*std::declval<OutputIterator&>() = IntRep()))
 {
+    if (_empty)
+        return;
+
     const IntRep INV_A = fast_exp(MULT_A, IntRep(-1));
     const IntRep MIX_INV_L = fast_exp(MIX_MULT_L, IntRep(-1));
 
-    boost::container::static_vector<IntRep, count> _mixercopy;
-    std::copy(_mixer.begin(), _mixer.end(), std::back_inserter(_mixercopy));
+    IntRep _mixercopy[count];
+    std::copy(_mixer, _mixer + count, _mixercopy);
 
     for (std::size_t round = 0; round < mix_rounds; ++round) {
         // Advance to the final value. We'll backtrack from that.
         auto hash_const = INIT_A*fast_exp(MULT_A, IntRep(count * count));
 
-        for (auto src = _mixercopy.rbegin(); src != _mixercopy.rend(); ++src)
-            for (auto dest = _mixercopy.rbegin(); dest != _mixercopy.rend();
-                 ++dest)
+        for (std::size_t src = count; src-- > 0; )
+            for (std::size_t dest = count; dest-- > 0; )
                 if (src != dest) {
-                    IntRep revhashed = *src;
+                    IntRep revhashed = _mixercopy[src];
                     auto mult_const = hash_const;
                     hash_const *= INV_A;
                     revhashed ^= hash_const;
                     revhashed *= mult_const;
                     revhashed ^= revhashed >> XSHIFT;
-                    IntRep unmixed = *dest;
+                    IntRep unmixed = _mixercopy[dest];
                     unmixed ^= unmixed >> XSHIFT;
                     unmixed += MIX_MULT_R*revhashed;
                     unmixed *= MIX_INV_L;
-                    *dest = unmixed;
+                    _mixercopy[dest] = unmixed;
                 }
-        for (auto i = _mixercopy.rbegin(); i != _mixercopy.rend(); ++i) {
-            IntRep unhashed = *i;
+        for (std::size_t i = count; i-- > 0; ) {
+            IntRep unhashed = _mixercopy[i];
             unhashed ^= unhashed >> XSHIFT;
             unhashed *= fast_exp(hash_const, IntRep(-1));
             hash_const *= INV_A;
             unhashed ^= hash_const;
-            *i = unhashed;
+            _mixercopy[i] = unhashed;
         }
     }
-    std::copy(_mixercopy.begin(), _mixercopy.end(), dest);
+    std::copy(_mixercopy, _mixercopy + count, dest);
 }
 
 
 template <std::size_t count, std::size_t mix_rounds>
 template <typename RandomAccessIterator>
+SEED_SEQ_FE_GENERALIZED_CONSTEXPR
 void seed_seq_fe<count, mix_rounds>::generate(
         RandomAccessIterator dest_begin,
         RandomAccessIterator dest_end) const
+        noexcept(noexcept(*std::declval<RandomAccessIterator&>() = IntRep()))
+{
+#if defined(__AVX2__)
+    if (!SEED_SEQ_FE_IS_CONSTANT_EVALUATED() && dest_end - dest_begin >= 16) {
+        generate_simd(dest_begin, dest_end);
+        return;
+    }
+#endif
+
+    generate_scalar(dest_begin, dest_end, 0, INIT_B);
+}
+
+#if defined(__AVX2__)
+template <std::size_t count, std::size_t mix_rounds>
+template <typename RandomAccessIterator>
+void seed_seq_fe<count, mix_rounds>::generate_simd(
+        RandomAccessIterator dest_begin,
+        RandomAccessIterator dest_end) const
 {
-    auto src_begin = _mixer.begin();
-    auto src_end   = _mixer.end();
-    auto src       = src_begin;
+    // Generates 16 words per step. The hash constants of the words of a
+    // step are hash_const times the powers MULT_B^j (and MULT_B^(j + 1)),
+    // the words of a step are independent of each other.
+    BOOST_ALIGNMENT(32) IntRep powers[17];
+    powers[0] = IntRep(1);
+    for (std::size_t j = 1; j < 17; ++j)
+        powers[j] = powers[j - 1] * MULT_B;
+    const __m256i pow_lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(powers));
+    const __m256i pow_hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(powers + 8));
+    const __m256i powb_lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(powers + 1));
+    const __m256i powb_hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(powers + 9));
+    const IntRep step_mult = powers[16];
+
+    // The store repeated, such that any 16 consecutive words of the
+    // source can be loaded from it.
+    IntRep source[count + 16];
+    for (std::size_t j = 0; j < count + 16; ++j)
+        source[j] = _mixer[j % count];
+    std::size_t offset = 0;
     auto hash_const = INIT_B;
-    for (auto dest = dest_begin; dest != dest_end; ++dest) {
-        auto dataval = *src;
-        if (++src == src_end)
-            src = src_begin;
-        dataval ^= hash_const;
+
+    auto dest = dest_begin;
+    BOOST_ALIGNMENT(32) IntRep block[16];
+    for (; dest_end - dest >= 16; dest += 16) {
+        const __m256i hc = _mm256_set1_epi32(static_cast<int>(hash_const));
+        const __m256i lo = hash_block(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset)),
+            _mm256_mullo_epi32(hc, pow_lo), _mm256_mullo_epi32(hc, powb_lo));
+        const __m256i hi = hash_block(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset + 8)),
+            _mm256_mullo_epi32(hc, pow_hi), _mm256_mullo_epi32(hc, powb_hi));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(block), lo);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(block + 8), hi);
+        std::copy(block, block + 16, dest);
+        hash_const *= step_mult;
+        offset = (offset + 16) % count;
+    }
+    generate_scalar(dest, dest_end, offset, hash_const);
+}
+#endif
+
+template <std::size_t count, std::size_t mix_rounds>
+template <typename RandomAccessIterator>
+SEED_SEQ_FE_GENERALIZED_CONSTEXPR
+void seed_seq_fe<count, mix_rounds>::generate_scalar(
+        RandomAccessIterator dest, RandomAccessIterator dest_end,
+        std::size_t src, IntRep hash_const) const
+{
+    for (; dest != dest_end; ++dest) {
+        const IntRep dataval = _mixer[src];
+        if (++src == count)
+            src = 0;
+        const IntRep xor_const = hash_const;
         hash_const *= MULT_B;
-        dataval *= hash_const;
-        dataval ^= dataval >> XSHIFT;
-        *dest = dataval;
+        *dest = hash(dataval, xor_const, hash_const);
     }
 }
 
@@ -0,0 +1,192 @@
+/* boost random/shuffle.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_SHUFFLE_HPP
+#define BOOST_RANDOM_SHUFFLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+
+#include "uniform_bounded.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * Two values, uniform in [0, b1) and [0, b2), from one 64-bit draw,
+     * b1 * b2 <= 2^64 (Brackett-Rozinsky and Lemire, batched ranged
+     * random integers): the high words of x * b1 and of (the low word of
+     * x * b1) * b2. The low word of the last product decides on
+     * rejection.
+     */
+    template<class Engine>
+    inline void uniform_bounded_pair(Engine& eng, std::uint64_t b1, std::uint64_t b2,
+                                     std::uint64_t& r1, std::uint64_t& r2)
+    {
+        const std::uint64_t product = b1 * b2;
+        std::uint64_t lo;
+        r1 = mul_128(bounded_bits(eng, boost::false_type()), b1, lo);
+        r2 = mul_128(lo, b2, lo);
+        if (lo < product) {
+            const std::uint64_t t = (0 - product) % product;
+            while (lo < t) {
+                r1 = mul_128(bounded_bits(eng, boost::false_type()), b1, lo);
+                r2 = mul_128(lo, b2, lo);
+            }
+        }
+    }
+
+    /**
+     * The swap targets of the m Fisher-Yates steps from position n - 1
+     * down, target k is uniform in [0, n - k). Two targets are taken from
+     * one 64-bit draw while n < 2^32.
+     */
+    template<class Engine>
+    inline void shuffle_targets(Engine& eng, std::uint64_t n, std::uint64_t* targets, std::size_t m)
+    {
+        std::size_t k = 0;
+        if (n <= 0xFFFFFFFF) {
+            for (; k + 1 < m; k += 2) {
+                uniform_bounded_pair(eng, n - k, n - k - 1, targets[k], targets[k + 1]);
+            }
+        }
+        for (; k < m; ++k) {
+            targets[k] = n - k <= 0xFFFFFFFF
+                ? uniform_bounded_impl(eng, static_cast<std::uint32_t>(n - k))
+                : uniform_bounded_impl(eng, n - k);
+        }
+    }
+
+    // The number of Fisher-Yates steps of which the targets are drawn
+    // and prefetched together, a batch ahead of the swaps.
+    const std::size_t shuffle_batch_size = 16;
+
+    /**
+     * Draws the targets of the next batch of steps from position n - 1
+     * down and prefetches them, returns the number of steps.
+     */
+    template<class RandomIt, class Engine>
+    inline std::size_t shuffle_batch(RandomIt first, Engine& eng, std::uint64_t n, std::uint64_t* targets)
+    {
+        typedef typename std::iterator_traits<RandomIt>::difference_type difference_type;
+        if (n <= 1) {
+            return 0;
+        }
+        const std::size_t m = static_cast<std::size_t>((std::min)(n - 1, static_cast<std::uint64_t>(shuffle_batch_size)));
+        shuffle_targets(eng, n, targets, m);
+        for (std::size_t k = 0; k < m; ++k) {
+            prefetch(std::addressof(first[static_cast<difference_type>(targets[k])]));
+        }
+        return m;
+    }
+
+} // namespace detail
+
+/**
+ * Shuffles [first, last) with the Fisher-Yates algorithm, each
+ * permutation is equally likely (up to the quality of @c eng).
+ *
+ * The swap targets are drawn in batches with the multiply-shift of
+ * uniform_bounded(), two from a single 64-bit draw while fewer than 2^32
+ * elements remain. The targets of a batch are drawn and prefetched while
+ * the previous batch is swapped, which hides the cache misses on large
+ * arrays.
+ */
+template<class RandomIt, class Engine>
+void shuffle(RandomIt first, RandomIt last, Engine& eng)
+{
+    typedef typename Engine::result_type result_type;
+    BOOST_STATIC_ASSERT(std::numeric_limits<result_type>::digits == 32 || std::numeric_limits<result_type>::digits == 64);
+    BOOST_ASSERT((eng.min)() == 0 && (eng.max)() == (std::numeric_limits<result_type>::max)());
+    typedef typename std::iterator_traits<RandomIt>::difference_type difference_type;
+
+    std::uint64_t n = static_cast<std::uint64_t>(last - first);
+    std::uint64_t targets[2][detail::shuffle_batch_size];
+    std::size_t m = detail::shuffle_batch(first, eng, n, targets[0]);
+    for (int b = 0; m; b ^= 1) {
+        // The next batch is in flight while this one is swapped.
+        const std::size_t next = detail::shuffle_batch(first, eng, n - m, targets[b ^ 1]);
+        for (std::size_t k = 0; k < m; ++k) {
+            using std::swap;
+            swap(first[static_cast<difference_type>(n - 1 - k)], first[static_cast<difference_type>(targets[b][k])]);
+        }
+        n -= m, m = next;
+    }
+}
+
+/**
+ * Copies @c k elements of [first, last), chosen uniformly without
+ * replacement, to @c out, or all elements if there are fewer than @c k.
+ * Returns the end of the output range.
+ *
+ * Uses reservoir sampling: the first @c k elements are copied and element
+ * i >= k replaces a random output element with probability k / (i + 1),
+ * drawn in pairs as in shuffle(). The order of the output is therefore
+ * not that of the input. [first, last) is read once, in order.
+ */
+template<class InputIt, class RandomIt, class Engine>
+RandomIt sample(InputIt first, InputIt last, RandomIt out, std::size_t k, Engine& eng)
+{
+    typedef typename Engine::result_type result_type;
+    BOOST_STATIC_ASSERT(std::numeric_limits<result_type>::digits == 32 || std::numeric_limits<result_type>::digits == 64);
+    BOOST_ASSERT((eng.min)() == 0 && (eng.max)() == (std::numeric_limits<result_type>::max)());
+    typedef typename std::iterator_traits<RandomIt>::difference_type difference_type;
+
+    if (!k) {
+        return out;
+    }
+    std::uint64_t i = 0;
+    for (; i < k && first != last; ++i, ++first) {
+        out[static_cast<difference_type>(i)] = *first;
+    }
+    if (i < k) {
+        return out + static_cast<difference_type>(i);
+    }
+    while (first != last) {
+        std::uint64_t j1, j2;
+        if (i + 2 <= 0xFFFFFFFF) {
+            detail::uniform_bounded_pair(eng, i + 1, i + 2, j1, j2);
+        }
+        else {
+            j1 = detail::uniform_bounded_impl(eng, i + 1);
+            j2 = detail::uniform_bounded_impl(eng, i + 2);
+        }
+        if (j1 < k) {
+            out[static_cast<difference_type>(j1)] = *first;
+        }
+        if (++first == last) {
+            break;
+        }
+        if (j2 < k) {
+            out[static_cast<difference_type>(j2)] = *first;
+        }
+        ++first, i += 2;
+    }
+    return out + static_cast<difference_type>(k);
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_SHUFFLE_HPP
@@ -15,6 +15,16 @@
 #ifndef BOOST_RANDOM_TAUS88_HPP
 #define BOOST_RANDOM_TAUS88_HPP
 
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/utility/enable_if.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "linear_feedback_shift.hpp"
 #include "xor_combine.hpp"
 
@@ -36,9 +46,184 @@ typedef xor_combine_engine<
         linear_feedback_shift_engine<uint32_t, 32, 29,  2,  4>, 0>, 0,
     linear_feedback_shift_engine<uint32_t, 32, 28, 3, 17>, 0> taus88;
 
+/**
+ * The specialization lfsr113 was suggested in
+ *
+ *  @blockquote
+ *  "Tables of Maximally-Equidistributed Combined LFSR Generators",
+ *  Pierre L'Ecuyer, Mathematics of Computation, Volume 68,
+ *  Number 225, January 1999, Pages 261-269
+ *  @endblockquote
+ */
+typedef xor_combine_engine<
+    xor_combine_engine<
+        xor_combine_engine<
+            linear_feedback_shift_engine<uint32_t, 32, 31,  6, 18>, 0,
+            linear_feedback_shift_engine<uint32_t, 32, 29,  2,  2>, 0>, 0,
+        linear_feedback_shift_engine<uint32_t, 32, 28, 13,  7>, 0>, 0,
+    linear_feedback_shift_engine<uint32_t, 32, 25,  3, 13>, 0> lfsr113;
+
+namespace detail {
+
+/**
+ * Describes a combined Tausworthe generator, i.e. (a tree of)
+ * un-shifted @c xor_combine_engine(s) of 32-bit
+ * @c linear_feedback_shift_engine(s), as a set of lanes, one lane per
+ * component. taus88 occupies 3 lanes, lfsr113 occupies 4 lanes.
+ */
+template<class Engine>
+struct tausworthe_lanes : boost::false_type
+{
+    BOOST_STATIC_CONSTANT(std::size_t, size = 0);
+};
+
+template<int k, int q, int s>
+struct tausworthe_lanes<linear_feedback_shift_engine<uint32_t, 32, k, q, s> >
+  : boost::true_type
+{
+    typedef linear_feedback_shift_engine<uint32_t, 32, k, q, s> engine_type;
+
+    BOOST_STATIC_CONSTANT(std::size_t, size = 1);
+
+    static void params(uint32_t *shift_q, uint32_t *shift_b,
+                       uint32_t *shift_s, uint32_t *mask)
+    {
+        *shift_q = q;
+        *shift_b = k - s;
+        *shift_s = s;
+        *mask = engine_type::state_mask;
+    }
+
+    static void load(const engine_type &eng, uint32_t *z)
+    { *z = eng.value; }
+
+    static void store(engine_type &eng, const uint32_t *z)
+    { eng.value = *z; }
+};
+
+template<class URNG1, class URNG2>
+struct tausworthe_lanes<xor_combine_engine<URNG1, 0, URNG2, 0> >
+  : boost::integral_constant<bool,
+        tausworthe_lanes<URNG1>::value && tausworthe_lanes<URNG2>::value>
+{
+    typedef xor_combine_engine<URNG1, 0, URNG2, 0> engine_type;
+    typedef tausworthe_lanes<URNG1> lanes1;
+    typedef tausworthe_lanes<URNG2> lanes2;
+
+    BOOST_STATIC_CONSTANT(std::size_t, size = lanes1::size + lanes2::size);
+
+    static void params(uint32_t *shift_q, uint32_t *shift_b,
+                       uint32_t *shift_s, uint32_t *mask)
+    {
+        lanes1::params(shift_q, shift_b, shift_s, mask);
+        lanes2::params(shift_q + lanes1::size, shift_b + lanes1::size,
+                       shift_s + lanes1::size, mask + lanes1::size);
+    }
+
+    static void load(const engine_type &eng, uint32_t *z)
+    {
+        lanes1::load(eng.base1(), z);
+        lanes2::load(eng.base2(), z + lanes1::size);
+    }
+
+    static void store(engine_type &eng, const uint32_t *z)
+    { xor_combine_bulk<engine_type>::store(eng, z); }
+};
+
+#if defined(__AVX2__)
+
+/**
+ * Advances all components of a combined Tausworthe generator of up to
+ * 4 components in parallel in the lanes of one SSE register, using the
+ * AVX2 per-lane shifts. The outputs of 4 consecutive steps are reduced
+ * (xor-ed over the lanes) with a single transpose, which keeps the
+ * reduction off the dependency chain of the state update. The produced
+ * sequence is identical to the one produced by repeated calls to
+ * @c operator().
+ */
+template<class URNG1, class URNG2>
+struct xor_combine_bulk<xor_combine_engine<URNG1, 0, URNG2, 0>,
+    typename boost::enable_if_c<
+        tausworthe_lanes<xor_combine_engine<URNG1, 0, URNG2, 0> >::value
+        && tausworthe_lanes<xor_combine_engine<URNG1, 0, URNG2, 0> >::size <= 4
+    >::type>
+{
+    typedef xor_combine_engine<URNG1, 0, URNG2, 0> engine_type;
+    typedef tausworthe_lanes<engine_type> lanes;
+
+    static void store(engine_type &eng, const uint32_t *z)
+    {
+        tausworthe_lanes<URNG1>::store(eng._rng1, z);
+        tausworthe_lanes<URNG2>::store(eng._rng2, z + tausworthe_lanes<URNG1>::size);
+    }
+
+    template<class Iter>
+    static void generate(engine_type &eng, Iter first, Iter last)
+    {
+        // Unused lanes have a zero state and a zero mask, they remain zero
+        // and don't contribute to the output.
+        BOOST_ALIGNMENT(16) uint32_t z[4] = { 0 }, sq[4] = { 0 },
+            sb[4] = { 0 }, ss[4] = { 0 }, m[4] = { 0 };
+        lanes::load(eng, z);
+        lanes::params(sq, sb, ss, m);
+
+        const __m128i vq = _mm_load_si128(reinterpret_cast<const __m128i*>(sq));
+        const __m128i vb = _mm_load_si128(reinterpret_cast<const __m128i*>(sb));
+        const __m128i vs = _mm_load_si128(reinterpret_cast<const __m128i*>(ss));
+        const __m128i vm = _mm_load_si128(reinterpret_cast<const __m128i*>(m));
+        __m128i state[4];
+        state[3] = _mm_load_si128(reinterpret_cast<const __m128i*>(z));
+
+        BOOST_ALIGNMENT(16) uint32_t out[4];
+        while(first != last) {
+            state[0] = step(state[3], vq, vb, vs, vm);
+            state[1] = step(state[0], vq, vb, vs, vm);
+            state[2] = step(state[1], vq, vb, vs, vm);
+            state[3] = step(state[2], vq, vb, vs, vm);
+            _mm_store_si128(reinterpret_cast<__m128i*>(out),
+                reduce(state[0], state[1], state[2], state[3]));
+            for(std::size_t i = 0; i < 4; ++i) {
+                *first = out[i];
+                if(++first == last) {
+                    _mm_store_si128(reinterpret_cast<__m128i*>(z), state[i]);
+                    store(eng, z);
+                    return;
+                }
+            }
+        }
+        _mm_store_si128(reinterpret_cast<__m128i*>(z), state[3]);
+        store(eng, z);
+    }
+
+private:
+    static __m128i step(__m128i z, __m128i vq, __m128i vb,
+                        __m128i vs, __m128i vm)
+    {
+        const __m128i b = _mm_srlv_epi32(
+            _mm_xor_si128(_mm_sllv_epi32(z, vq), z), vb);
+        return _mm_xor_si128(_mm_sllv_epi32(_mm_and_si128(z, vm), vs), b);
+    }
+
+    // Returns { xor(a), xor(b), xor(c), xor(d) }, xor-ing over the lanes.
+    static __m128i reduce(__m128i a, __m128i b, __m128i c, __m128i d)
+    {
+        const __m128i ab = _mm_xor_si128(_mm_unpacklo_epi32(a, b),
+                                         _mm_unpackhi_epi32(a, b));
+        const __m128i cd = _mm_xor_si128(_mm_unpacklo_epi32(c, d),
+                                         _mm_unpackhi_epi32(c, d));
+        return _mm_xor_si128(_mm_unpacklo_epi64(ab, cd),
+                             _mm_unpackhi_epi64(ab, cd));
+    }
+};
+
+#endif // __AVX2__
+
+} // namespace detail
+
 } // namespace random
 
 using random::taus88;
+using random::lfsr113;
 
 } // namespace boost
 
@@ -0,0 +1,132 @@
+/* boost random/thread_engine.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_THREAD_ENGINE_HPP
+#define BOOST_RANDOM_THREAD_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+
+#include <boost/config.hpp>
+#include <boost/align/aligned_alloc.hpp>
+#include <boost/align/aligned_delete.hpp>
+
+#include "seed_seq_fe.hpp"
+#include "xoroshiro.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * The seed sequence of all thread engines, seeded once from
+     * std::random_device.
+     */
+    inline const seed_seq_fe256& thread_engine_seed_seq()
+    {
+        struct entropy
+        {
+            entropy()
+            {
+                std::random_device device;
+                for (std::size_t i = 0; i < sizeof(words) / sizeof(words[0]); ++i) {
+                    words[i] = device();
+                }
+            }
+
+            std::uint32_t words[seed_seq_fe256::size()];
+        };
+        static const entropy e;
+        static const seed_seq_fe256 seq(e.words, e.words + seed_seq_fe256::size());
+        return seq;
+    }
+
+    /**
+     * The engine of a thread, on cache lines of its own: the engines of
+     * different threads never share a line.
+     */
+    template<class Engine>
+    struct BOOST_ALIGNMENT(64) thread_engine_state
+    {
+        explicit thread_engine_state(const Engine& eng) : engine(eng) { }
+
+        Engine engine;
+    };
+
+    template<class Engine>
+    struct thread_engine_streams
+    {
+        /**
+         * Returns the engine of the next thread: the engine seeded from
+         * thread_engine_seed_seq() advanced by jump() once per earlier
+         * thread, so the streams of the threads never overlap.
+         */
+        static Engine next()
+        {
+            static std::mutex mutex;
+            static Engine cursor(thread_engine_seed_seq());
+            std::lock_guard<std::mutex> lock(mutex);
+            const Engine eng(cursor);
+            cursor.jump();
+            return eng;
+        }
+    };
+
+    // Allocated and written by the calling thread, so the first touch
+    // puts a fresh page on the NUMA node the thread runs on (and glibc
+    // serves the allocations of a thread from an arena of its own).
+    template<class Engine>
+    BOOST_NOINLINE thread_engine_state<Engine>* make_thread_engine()
+    {
+        typedef thread_engine_state<Engine> state_type;
+        void* p = boost::alignment::aligned_alloc(64, sizeof(state_type));
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return ::new(p) state_type(thread_engine_streams<Engine>::next());
+    }
+
+} // namespace detail
+
+/**
+ * Returns the engine of the calling thread. The engine is created on the
+ * first call of the thread and destroyed when the thread exits.
+ *
+ * All thread engines of a type are seeded from a single seed_seq_fe256,
+ * itself seeded from std::random_device, the engine of the k-th thread
+ * is advanced by jump() k times: the threads draw from non-overlapping
+ * streams. The state is allocated by the calling thread, cache line
+ * aligned and padded to whole cache lines.
+ *
+ * Engine is one of the engines of xoroshiro.hpp, excluding splitmix64.
+ */
+template<class Engine = xoroshiro128plusshixo>
+inline Engine& thread_engine()
+{
+    typedef detail::thread_engine_state<Engine> state_type;
+    thread_local std::unique_ptr<state_type, boost::alignment::aligned_delete> state;
+    if (BOOST_UNLIKELY(!state)) {
+        state.reset(detail::make_thread_engine<Engine>());
+    }
+    return state->engine;
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_THREAD_ENGINE_HPP
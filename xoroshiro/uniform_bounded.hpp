@@ -0,0 +1,303 @@
+/* boost random/uniform_bounded.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_UNIFORM_BOUNDED_HPP
+#define BOOST_RANDOM_UNIFORM_BOUNDED_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(BOOST_HAS_INT128)
+#include <intrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#endif
+
+#include "generate_canonical_bulk.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    // The high word of a * b, the low word is stored in lo.
+    inline std::uint64_t mul_128(std::uint64_t a, std::uint64_t b, std::uint64_t& lo)
+    {
+#if defined(BOOST_HAS_INT128)
+        const boost::uint128_type m = static_cast<boost::uint128_type>(a) * b;
+        lo = static_cast<std::uint64_t>(m);
+        return static_cast<std::uint64_t>(m >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        std::uint64_t hi;
+        lo = _umul128(a, b, &hi);
+        return hi;
+#else
+        const std::uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+        const std::uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+        const std::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo;
+        const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+        lo = (mid << 32) | (ll & 0xFFFFFFFF);
+        return a_hi * b_hi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+    }
+
+    // Prefetches the cache line of p, for tables indexed by bounded values.
+    inline void prefetch(const void* p)
+    {
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(p);
+#else
+        (void)p;
+#endif
+    }
+
+    // 32 random bits, the upper half of a 64-bit output.
+    template<class Engine>
+    inline std::uint32_t bounded_bits(Engine& eng, boost::true_type)
+    {
+        const typename Engine::result_type x = eng();
+        return static_cast<std::uint32_t>(std::numeric_limits<typename Engine::result_type>::digits == 64 ? static_cast<std::uint64_t>(x) >> 32 : x);
+    }
+
+    // 64 random bits, two 32-bit outputs are combined, the first in the low word.
+    template<class Engine>
+    inline std::uint64_t bounded_bits(Engine& eng, boost::false_type)
+    {
+        if (std::numeric_limits<typename Engine::result_type>::digits == 64) {
+            return static_cast<std::uint64_t>(eng());
+        }
+        const std::uint64_t lo = static_cast<std::uint64_t>(eng());
+        return lo | (static_cast<std::uint64_t>(eng()) << 32);
+    }
+
+    template<class Engine>
+    inline std::uint32_t uniform_bounded_impl(Engine& eng, std::uint32_t bound)
+    {
+        std::uint64_t m = static_cast<std::uint64_t>(bounded_bits(eng, boost::true_type())) * bound;
+        std::uint32_t l = static_cast<std::uint32_t>(m);
+        if (l < bound) {
+            // Only here do we pay for the division.
+            const std::uint32_t t = static_cast<std::uint32_t>(0 - bound) % bound;
+            while (l < t) {
+                m = static_cast<std::uint64_t>(bounded_bits(eng, boost::true_type())) * bound;
+                l = static_cast<std::uint32_t>(m);
+            }
+        }
+        return static_cast<std::uint32_t>(m >> 32);
+    }
+
+    template<class Engine>
+    inline std::uint64_t uniform_bounded_impl(Engine& eng, std::uint64_t bound)
+    {
+        std::uint64_t l;
+        std::uint64_t h = mul_128(bounded_bits(eng, boost::false_type()), bound, l);
+        if (l < bound) {
+            const std::uint64_t t = (0 - bound) % bound;
+            while (l < t) {
+                h = mul_128(bounded_bits(eng, boost::false_type()), bound, l);
+            }
+        }
+        return h;
+    }
+
+    // The unsigned type the bound is converted to, 32 or 64 bits. A
+    // signed bound (positive) fits in the unsigned type of its width.
+    template<class IntType>
+    struct bounded_type
+    {
+        BOOST_STATIC_ASSERT_MSG(std::numeric_limits<IntType>::is_integer && std::numeric_limits<IntType>::digits <= 64,
+                                "the bound must be an integer of at most 64 bits");
+        typedef typename boost::conditional<std::numeric_limits<IntType>::digits <= 32, std::uint32_t, std::uint64_t>::type type;
+    };
+
+#if defined(__AVX2__)
+    // Flags the lanes set in mask, rejections are rare.
+    inline std::size_t flag_rejected(unsigned mask, bool* rejected, int lanes)
+    {
+        std::size_t count = 0;
+        for (int j = 0; j < lanes; ++j) {
+            if (mask >> j & 1) {
+                rejected[j] = true, ++count;
+            }
+        }
+        return count;
+    }
+#endif
+
+    /**
+     * Maps the block bits to [0, bound), a rejected value is flagged in
+     * rejected, the number of rejected values is returned.
+     */
+    inline std::size_t bounded_block(const std::uint32_t* bits, std::uint32_t bound, std::uint32_t t,
+                                     std::uint32_t* out, bool* rejected, std::size_t n)
+    {
+        std::size_t count = 0, i = 0;
+#if defined(__AVX512F__)
+        const __m512i b16 = _mm512_set1_epi32(static_cast<int>(bound));
+        const __m512i t16 = _mm512_set1_epi32(static_cast<int>(t));
+        for (; i + 16 <= n; i += 16) {
+            const __m512i x = _mm512_loadu_si512(bits + i);
+            // Even and odd lanes, the 64-bit products.
+            const __m512i even = _mm512_mul_epu32(x, b16);
+            const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(x, 32), b16);
+            const __m512i hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+            const __m512i lo = _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+            _mm512_storeu_si512(out + i, hi);
+            const __mmask16 mask = _mm512_cmplt_epu32_mask(lo, t16);
+            if (mask) {
+                count += flag_rejected(mask, rejected + i, 16);
+            }
+        }
+#elif defined(__AVX2__)
+        const __m256i b8 = _mm256_set1_epi32(static_cast<int>(bound));
+        const __m256i t8 = _mm256_set1_epi32(static_cast<int>(t));
+        for (; i + 8 <= n; i += 8) {
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + i));
+            const __m256i even = _mm256_mul_epu32(x, b8);
+            const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), b8);
+            const __m256i hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+            const __m256i lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), hi);
+            // lo >= t, unsigned, is max(lo, t) == lo.
+            const __m256i ge = _mm256_cmpeq_epi32(_mm256_max_epu32(lo, t8), lo);
+            const unsigned mask = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(ge))) & 0xFF;
+            if (mask) {
+                count += flag_rejected(mask, rejected + i, 8);
+            }
+        }
+#endif
+        for (; i < n; ++i) {
+            const std::uint64_t m = static_cast<std::uint64_t>(bits[i]) * bound;
+            out[i] = static_cast<std::uint32_t>(m >> 32);
+            if (static_cast<std::uint32_t>(m) < t) {
+                rejected[i] = true, ++count;
+            }
+        }
+        return count;
+    }
+
+    inline std::size_t bounded_block(const std::uint64_t* bits, std::uint64_t bound, std::uint64_t t,
+                                     std::uint64_t* out, bool* rejected, std::size_t n)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint64_t l;
+            out[i] = mul_128(bits[i], bound, l);
+            if (l < t) {
+                rejected[i] = true, ++count;
+            }
+        }
+        return count;
+    }
+
+    template<class Engine>
+    inline void bounded_fill(Engine& eng, std::uint32_t* bits, std::size_t n)
+    {
+        canonical_words(eng, bits, n, canonical_by_generate<Engine>());
+    }
+
+    template<class Engine>
+    inline void bounded_fill(Engine& eng, std::uint64_t* bits, std::size_t n)
+    {
+        canonical_bits(eng, bits, n, canonical_by_generate<Engine>());
+    }
+
+} // namespace detail
+
+/**
+ * Returns a uniformly distributed value in [0, @c bound), with Lemire's
+ * multiply-shift: the high word of x * bound, x being 32 or 64 random
+ * bits. The low word decides on rejection, the division computing the
+ * threshold runs only if the low word is less than @c bound, i.e. with
+ * probability bound / 2^32 (or 2^64).
+ *
+ * Bounds up to 32 bits take the upper half of a 64-bit output, 64-bit
+ * bounds take two outputs of a 32-bit engine (the first in the low word).
+ * Engine must produce full-range 32- or 64-bit values, @c bound must be
+ * positive. The result has the type of @c bound, which may be signed:
+ * uniform_bounded(eng, 10) returns an int in [0, 10).
+ */
+template<class Engine, class IntType>
+IntType uniform_bounded(Engine& eng, IntType bound)
+{
+    typedef typename Engine::result_type result_type;
+    BOOST_STATIC_ASSERT(std::numeric_limits<result_type>::digits == 32 || std::numeric_limits<result_type>::digits == 64);
+    BOOST_ASSERT((eng.min)() == 0 && (eng.max)() == (std::numeric_limits<result_type>::max)());
+    BOOST_ASSERT(bound > 0);
+    typedef typename detail::bounded_type<IntType>::type bounded_type;
+    return static_cast<IntType>(detail::uniform_bounded_impl(eng, static_cast<bounded_type>(bound)));
+}
+
+/**
+ * Writes @c n uniformly distributed values in [0, @c bound) to @c out.
+ * The random bits are obtained and mapped in blocks, the values up to 32
+ * bits are mapped 8 (AVX2) or 16 (AVX-512) at a time, using both halves of
+ * a 64-bit output (low word first). Rejected values are drawn again with
+ * uniform_bounded() at the end of each block, so the results do not depend
+ * on the instruction set, but differ from n calls of uniform_bounded().
+ *
+ * Engine must produce full-range 32- or 64-bit values, @c bound must be
+ * positive, it may be signed (as for uniform_bounded()).
+ */
+template<class Engine, class IntType, class OutputIt>
+void generate_bounded(Engine& eng, IntType bound, OutputIt out, std::size_t n)
+{
+    typedef typename Engine::result_type result_type;
+    BOOST_STATIC_ASSERT(std::numeric_limits<result_type>::digits == 32 || std::numeric_limits<result_type>::digits == 64);
+    BOOST_ASSERT((eng.min)() == 0 && (eng.max)() == (std::numeric_limits<result_type>::max)());
+    BOOST_ASSERT(bound > 0);
+    typedef typename detail::bounded_type<IntType>::type bounded_type;
+
+    const bounded_type b = static_cast<bounded_type>(bound);
+    const bounded_type t = static_cast<bounded_type>(0 - b) % b;
+    // Values per block, 2 * 256 words or 256 64-bit values.
+    const std::size_t block_size = detail::canonical_block_size * sizeof(std::uint64_t) / sizeof(bounded_type);
+
+    bounded_type bits[block_size], values[block_size];
+    bool rejected[block_size] = { };
+    while (n) {
+        const std::size_t m = (std::min)(n, block_size);
+        detail::bounded_fill(eng, bits, m);
+        if (detail::bounded_block(bits, b, t, values, rejected, m)) {
+            for (std::size_t i = 0; i < m; ++i) {
+                if (rejected[i]) {
+                    values[i] = detail::uniform_bounded_impl(eng, b);
+                    rejected[i] = false;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < m; ++i, ++out) {
+            *out = static_cast<IntType>(values[i]);
+        }
+        n -= m;
+    }
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_UNIFORM_BOUNDED_HPP
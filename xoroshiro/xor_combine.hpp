@@ -213,6 +213,38 @@ namespace detail {
 		x = ((x >> 32) ^ x) * std::uint64_t { 0x1AEC805299990163 };
 		return (x >> 32) ^ x;
 	}
+
+	// Access to the base generators, used by binary_state.hpp.
+	template<class Engine>
+	struct binary_state_access;
+
+	/**
+	 * Bulk generation for a @c xor_combine_engine. The primary template
+	 * forwards to @c generate_from_int, specializations (see taus88.hpp)
+	 * can advance the base generators in parallel lanes. Specializations
+	 * have access to the base generators of the engine.
+	 */
+	template<class Engine, class Enable = void>
+	struct xor_combine_bulk
+	{
+		template<class Iter>
+		static void generate(Engine &eng, Iter first, Iter last)
+		{
+			// generate_from_int() writes a value before testing for the
+			// end, an empty range is left alone here.
+			if (first != last) {
+				generate_from_int(eng, first, last);
+			}
+		}
+	};
+
+	/**
+	 * The number of 32-bit words consumed by @c Engine::seed(first, last),
+	 * zero if not known at compile time. Engines that can be combined
+	 * specialize this (see linear_feedback_shift.hpp).
+	 */
+	template<class Engine>
+	struct seed_words : boost::integral_constant<std::size_t, 0> {};
 }
 
 
@@ -283,10 +315,10 @@ public:
      */
 	BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xor_combine_engine, result_type, v)
 	{
-		const result_type s1 = detail::xor_combine_integer_hash( v + 1U); // +1 to avoid any modular dependencies...
-		const result_type s2 = detail::xor_combine_integer_hash(s1 + 1U);
-		_rng1.seed(detail::xor_combine_integer_hash(s1 + 1U));
-		_rng2.seed(detail::xor_combine_integer_hash(s2 + 1U));
+		const result_type v1 = detail::xor_combine_integer_hash( v + 1U); // +1 to avoid any modular dependencies...
+		const result_type v2 = detail::xor_combine_integer_hash(v1 + 1U);
+		_rng1.seed(detail::xor_combine_integer_hash(v1 + 1U));
+		_rng2.seed(detail::xor_combine_integer_hash(v2 + 1U));
 	}
 
 public:
@@ -307,10 +339,40 @@ public:
 		//_rng2.seed(gen);
     }
 
+    /**
+     * @c seeds both base generators with values produced by @c seq. If the
+     * number of words required by both base generators is known at compile
+     * time, these are generated in one call into a stack array and consumed
+     * directly by the base generators, i.e. without any allocation or
+     * intermediate seed sequences.
+     *
+     * This changes the stream of an engine seeded from a SeedSeq: taus88
+     * and lfsr113 formerly generated 2 * seq.size() words and seeded each
+     * base generator from a SeedSeq of its half, they now take their
+     * words directly from @c seq (the first base generator first). A
+     * state seeded by an earlier version is not reproduced, seed with
+     * seed(first, last) from the words of a SeedSeq of the old halves
+     * where it must be.
+     */
+	template<typename SeedSeq>
+	std::enable_if_t<
+		traits::is_seed_seq<SeedSeq>::value
+		&& (detail::seed_words<xor_combine_engine>::value != 0)
+	>
+    seed(const SeedSeq &seq)
+    {
+        std::uint_least32_t storage[detail::seed_words<xor_combine_engine>::value];
+        seq.generate(std::begin(storage), std::end(storage));
+        std::uint_least32_t *first = std::begin(storage);
+        _rng1.seed(first, std::end(storage));
+        _rng2.seed(first, std::end(storage));
+    }
+
     /** @c seeds both base generators with values produced by @c seq. */
 	template<typename SeedSeq>
 	std::enable_if_t<
 		traits::is_seed_seq<SeedSeq>::value
+		&& (detail::seed_words<xor_combine_engine>::value == 0)
 	>
     seed(const SeedSeq &seq)
     {
@@ -348,9 +410,14 @@ public:
     /** Fills a range with random values */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    { detail::xor_combine_bulk<xor_combine_engine>::generate(*this, first, last); }
 
-    /** Advances the state of the generator by @c z. */
+    /**
+     * Advances the state of the generator by @c z. Forwards to both base
+     * generators, for base generators that jump ahead in logarithmic time
+     * (like @c linear_feedback_shift_engine, hence taus88 and lfsr113) this
+     * can be used to split a stream in non-overlapping sub-streams.
+     */
     void discard(boost::uintmax_t z)
     {
         _rng1.discard(z);
@@ -389,6 +456,9 @@ public:
 
 private:
 	/// \cond show_private
+    template<class Engine, class Enable> friend struct detail::xor_combine_bulk;
+    template<class Engine> friend struct detail::binary_state_access;
+
     template<typename SeedSeq, typename Storage>
     void forward_array_int(const Storage &storage)
     {
@@ -405,6 +475,15 @@ private:
     base2_type _rng2;
 };
 
+namespace detail {
+
+	template<class URNG1, int s1, class URNG2, int s2>
+	struct seed_words<xor_combine_engine<URNG1, s1, URNG2, s2> >
+	  : boost::integral_constant<std::size_t,
+			(seed_words<URNG1>::value != 0 && seed_words<URNG2>::value != 0)
+				? seed_words<URNG1>::value + seed_words<URNG2>::value : 0> {};
+}
+
 #ifndef BOOST_NO_INCLASS_MEMBER_INITIALIZATION
 //  A definition is required even for integral static constants
 template<class URNG1, int s1, class URNG2, int s2>
@@ -0,0 +1,156 @@
+/*  Reentrant interface to the reference generators, see xoro.h. Link
+    with xoroshiro128plus.c, xoroshiro128starstar.c, xoshiro256plus.c and
+    xoshiro256starstar.c (built without XORO_GLOBAL_STATE). */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "xoro.h"
+
+/* The number of values converted per block by xoro_fill_double(). */
+#define XORO_BLOCK 256
+
+
+/* splitmix64, as in http://xoshiro.di.unimi.it/splitmix64.c */
+
+static uint64_t splitmix64_next(uint64_t *const x) {
+	uint64_t z = (*x += 0x9e3779b97f4a7c15);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+	return z ^ (z >> 31);
+}
+
+static int state_words(const xoro_kind_t kind) {
+	switch(kind) {
+	case XORO_XOROSHIRO128PLUS:
+	case XORO_XOROSHIRO128STARSTAR:
+		return 2;
+	case XORO_XOSHIRO256PLUS:
+	case XORO_XOSHIRO256STARSTAR:
+		return 4;
+	}
+	return 0;
+}
+
+int xoro_seed(xoro_state_t *state, xoro_kind_t kind, uint64_t seed) {
+	const int words = state_words(kind);
+	if (!words)
+		return -1;
+
+	/* Consecutive outputs of splitmix64 differ, the state is not zero. */
+	for(int i = 0; i < 4; i++)
+		state->s[i] = i < words ? splitmix64_next(&seed) : 0;
+	state->kind = (uint32_t)kind;
+	return 0;
+}
+
+int xoro_set_state(xoro_state_t *state, xoro_kind_t kind, const uint64_t *words) {
+	const int n = state_words(kind);
+	uint64_t any = 0;
+	for(int i = 0; i < n; i++)
+		any |= words[i];
+	if (!any)
+		return -1;
+
+	for(int i = 0; i < 4; i++)
+		state->s[i] = i < n ? words[i] : 0;
+	state->kind = (uint32_t)kind;
+	return 0;
+}
+
+/* The kind of a state is set by xoro_seed() or xoro_set_state(), an
+   unknown kind (an uninitialized or corrupt state) is a bug of the caller:
+   it asserts, without assertions the functions yield zeros and leave the
+   state alone rather than run some other generator on it. */
+
+uint64_t xoro_next(xoro_state_t *state) {
+	switch(state->kind) {
+	case XORO_XOROSHIRO128PLUS: return xoroshiro128plus_next(state);
+	case XORO_XOROSHIRO128STARSTAR: return xoroshiro128starstar_next(state);
+	case XORO_XOSHIRO256PLUS: return xoshiro256plus_next(state);
+	case XORO_XOSHIRO256STARSTAR: return xoshiro256starstar_next(state);
+	}
+	assert(!"xoro_next: unknown kind");
+	return 0;
+}
+
+void xoro_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n) {
+	switch(state->kind) {
+	case XORO_XOROSHIRO128PLUS: xoroshiro128plus_fill_u64(state, buf, n); return;
+	case XORO_XOROSHIRO128STARSTAR: xoroshiro128starstar_fill_u64(state, buf, n); return;
+	case XORO_XOSHIRO256PLUS: xoshiro256plus_fill_u64(state, buf, n); return;
+	case XORO_XOSHIRO256STARSTAR: xoshiro256starstar_fill_u64(state, buf, n); return;
+	}
+	assert(!"xoro_fill_u64: unknown kind");
+	memset(buf, 0, n * sizeof(*buf));
+}
+
+void xoro_jump_n(xoro_state_t *state, uint64_t n) {
+	switch(state->kind) {
+	case XORO_XOROSHIRO128PLUS: xoroshiro128plus_jump_n(state, n); return;
+	case XORO_XOROSHIRO128STARSTAR: xoroshiro128starstar_jump_n(state, n); return;
+	case XORO_XOSHIRO256PLUS: xoshiro256plus_jump_n(state, n); return;
+	case XORO_XOSHIRO256STARSTAR: xoshiro256starstar_jump_n(state, n); return;
+	}
+	assert(!"xoro_jump_n: unknown kind");
+}
+
+void xoro_long_jump(xoro_state_t *state) {
+	switch(state->kind) {
+	case XORO_XOROSHIRO128PLUS: xoroshiro128plus_long_jump(state); return;
+	case XORO_XOROSHIRO128STARSTAR: xoroshiro128starstar_long_jump(state); return;
+	case XORO_XOSHIRO256PLUS: xoshiro256plus_long_jump(state); return;
+	case XORO_XOSHIRO256STARSTAR: xoshiro256starstar_long_jump(state); return;
+	}
+	assert(!"xoro_long_jump: unknown kind");
+}
+
+/* The conversion of canonical_convert() in generate_canonical_bulk.hpp,
+   bit for bit. */
+
+void xoro_canonical_doubles(const uint64_t *bits, double *out, size_t n) {
+	const double scale = 1.0 / (double)(UINT64_C(1) << 53);
+	size_t i = 0;
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+	const __m512d scale8 = _mm512_set1_pd(scale);
+	for(; i + 8 <= n; i += 8) {
+		const __m512i x = _mm512_srli_epi64(_mm512_loadu_si512(bits + i), 11);
+		_mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_cvtepu64_pd(x), scale8));
+	}
+#elif defined(__AVX2__)
+	/* No 64-bit integer to double conversion in AVX2, the 53 bits are
+	   converted exactly as 2^84 + hi * 2^32 - 2^84 plus 2^52 + lo - 2^52. */
+	const __m256i exp_hi = _mm256_set1_epi64x(0x4530000000000000);
+	const __m256i exp_lo = _mm256_set1_epi64x(0x4330000000000000);
+	const __m256d bias_hi = _mm256_set1_pd(19342813113834066795298816.0); /* 2^84 */
+	const __m256d bias_lo = _mm256_set1_pd(4503599627370496.0);           /* 2^52 */
+	const __m256d scale4 = _mm256_set1_pd(scale);
+	for(; i + 4 <= n; i += 4) {
+		const __m256i x = _mm256_srli_epi64(_mm256_loadu_si256((const __m256i *)(bits + i)), 11);
+		const __m256i hi = _mm256_or_si256(_mm256_srli_epi64(x, 32), exp_hi);
+		const __m256i lo = _mm256_or_si256(_mm256_blend_epi32(x, _mm256_setzero_si256(), 0xAA), exp_lo);
+		const __m256d d = _mm256_add_pd(_mm256_sub_pd(_mm256_castsi256_pd(hi), bias_hi),
+		                                _mm256_sub_pd(_mm256_castsi256_pd(lo), bias_lo));
+		_mm256_storeu_pd(out + i, _mm256_mul_pd(d, scale4));
+	}
+#endif
+	for(; i < n; i++)
+		out[i] = (double)(bits[i] >> 11) * scale;
+}
+
+void xoro_fill_double(xoro_state_t *state, double *buf, size_t n) {
+	uint64_t bits[XORO_BLOCK];
+	while(n) {
+		const size_t k = n < XORO_BLOCK ? n : XORO_BLOCK;
+		xoro_fill_u64(state, bits, k);
+		xoro_canonical_doubles(bits, buf, k);
+		buf += k;
+		n -= k;
+	}
+}
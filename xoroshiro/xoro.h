@@ -0,0 +1,97 @@
+/*  Reentrant interface to the reference generators xoroshiro128plus.c,
+    xoroshiro128starstar.c, xoshiro256plus.c and xoshiro256starstar.c.
+
+    The state of a generator is a xoro_state_t owned by the caller, so
+    any number of generators can be used, one per thread or several per
+    thread, without locking. The bulk functions (xoro_fill_u64(),
+    xoro_fill_double()) run the generator with its state in registers
+    and produce a whole buffer per call, so that a caller through an FFI
+    (cffi, Rust) crosses the boundary once per buffer instead of once per
+    value. xoro_fill_double() converts with AVX2/AVX-512 where the build
+    enables them, giving the same doubles as the scalar conversion.
+
+    The layout of xoro_state_t is fixed (4 + 1 words of 64 + 32 bits), an
+    FFI can allocate it itself. */
+
+#ifndef XORO_H
+#define XORO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum xoro_kind_t {
+	XORO_XOROSHIRO128PLUS = 0,
+	XORO_XOROSHIRO128STARSTAR = 1,
+	XORO_XOSHIRO256PLUS = 2,
+	XORO_XOSHIRO256STARSTAR = 3
+} xoro_kind_t;
+
+typedef struct xoro_state_t {
+	uint64_t s[4];  /* the xoroshiro128 generators use s[0] and s[1] */
+	uint32_t kind;  /* a xoro_kind_t */
+} xoro_state_t;
+
+/* Seeds state as a generator of kind with the outputs of a splitmix64
+   seeded with seed, as the authors suggest. Returns 0, or -1 if kind is
+   unknown. */
+int xoro_seed(xoro_state_t *state, xoro_kind_t kind, uint64_t seed);
+
+/* Sets the state of a generator of kind to words (2 or 4 of them).
+   Returns 0, or -1 if kind is unknown or the words are all zero. */
+int xoro_set_state(xoro_state_t *state, xoro_kind_t kind, const uint64_t *words);
+
+/* Returns the next value of the generator. The functions below take a
+   state set by xoro_seed() or xoro_set_state(): a state of an unknown kind
+   fails an assertion, without assertions (NDEBUG) it yields zeros and is
+   left unchanged. */
+uint64_t xoro_next(xoro_state_t *state);
+
+/* Writes the next n values of the generator to buf. */
+void xoro_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n);
+
+/* Writes n doubles uniformly distributed in [0, 1) to buf, (x >> 11) *
+   2^-53 for the next n values x of the generator, as
+   generate_canonical_bulk() of the C++ headers. */
+void xoro_fill_double(xoro_state_t *state, double *buf, size_t n);
+
+/* Calls jump() n times: advances the generator by n * 2^64 values for
+   the xoroshiro128 generators, n * 2^128 for the xoshiro256 ones. */
+void xoro_jump_n(xoro_state_t *state, uint64_t n);
+
+/* Calls long_jump(): advances the generator by 2^96 or 2^192 values. */
+void xoro_long_jump(xoro_state_t *state);
+
+/* The functions of the generators, as the generic ones above, but
+   without the dispatch on state->kind. */
+uint64_t xoroshiro128plus_next(xoro_state_t *state);
+void xoroshiro128plus_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n);
+void xoroshiro128plus_jump_n(xoro_state_t *state, uint64_t n);
+void xoroshiro128plus_long_jump(xoro_state_t *state);
+
+uint64_t xoroshiro128starstar_next(xoro_state_t *state);
+void xoroshiro128starstar_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n);
+void xoroshiro128starstar_jump_n(xoro_state_t *state, uint64_t n);
+void xoroshiro128starstar_long_jump(xoro_state_t *state);
+
+uint64_t xoshiro256plus_next(xoro_state_t *state);
+void xoshiro256plus_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n);
+void xoshiro256plus_jump_n(xoro_state_t *state, uint64_t n);
+void xoshiro256plus_long_jump(xoro_state_t *state);
+
+uint64_t xoshiro256starstar_next(xoro_state_t *state);
+void xoshiro256starstar_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n);
+void xoshiro256starstar_jump_n(xoro_state_t *state, uint64_t n);
+void xoshiro256starstar_long_jump(xoro_state_t *state);
+
+/* Writes the doubles (bits[i] >> 11) * 2^-53 to out. */
+void xoro_canonical_doubles(const uint64_t *bits, double *out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XORO_H */
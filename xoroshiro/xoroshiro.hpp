@@ -18,25 +18,219 @@
 #include <istream>
 #include <ostream>
 #include <stdexcept>
-#include <vector>
 #include <iterator>
 #include <algorithm>
+#include <type_traits>
+#include <utility>
 
 #include <boost/config.hpp>
 #include <boost/random/detail/config.hpp>
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/seed_impl.hpp>
 #include <boost/detail/workaround.hpp>
+#include "instrumentation.hpp"
 #include <boost/random/detail/disable_warnings.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace boost {
 namespace random {
 
 #if !defined(BOOST_NO_INT64_T) && !defined(BOOST_NO_INTEGRAL_INT64_T)
 
+/// \cond show_private
+
+// As BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR/BOOST_RANDOM_DETAIL_SEED_SEQ_SEED,
+// but constexpr, allowing the engines to be seeded at compile time from a
+// constexpr SeedSeq (f.e. seed_seq_fe). Seeding from a SeedSeq does not
+// allocate, it is noexcept if SeedSeq::generate() and param() are (see
+// detail::seed_seq_is_nothrow).
+#define BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR(Self, SeedSeq, seq)    \
+    template<class SeedSeq>                                                 \
+    BOOST_CXX14_CONSTEXPR explicit Self(SeedSeq& seq, typename ::boost::random::detail::disable_constructor<Self, SeedSeq>::type* = 0) \
+        noexcept(::boost::random::detail::seed_seq_is_nothrow<SeedSeq>::value)
+
+#define BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED(Self, SeedSeq, seq)           \
+    template<class SeedSeq>                                                 \
+    BOOST_CXX14_CONSTEXPR void seed(SeedSeq& seq, typename ::boost::random::detail::disable_seed<SeedSeq>::type* = 0) \
+        noexcept(::boost::random::detail::seed_seq_is_nothrow<SeedSeq>::value)
+
+/// \endcond
+
     namespace detail {
 
-        std::uint64_t xoroshiro_integer_hash ( std::uint64_t x );
+        // const std::uint64_t v = 0x1AEC805299990163, y = 0xCDFB859A3DD0884B;
+
+        inline BOOST_CXX14_CONSTEXPR std::uint64_t xoroshiro_integer_hash ( std::uint64_t x )
+        {
+            x = ( ( x >> 32 ) ^ x ) * std::uint64_t { 0x1AEC805299990163 };
+            x = ( ( x >> 32 ) ^ x );
+            return x;
+        }
+
+        // Packs pairs of 32-bit words, low word first, as
+        // detail::seed_array_int<64, n> does, but constexpr.
+        template<std::size_t n>
+        BOOST_CXX14_CONSTEXPR std::uint64_t pack_seed_words ( const std::uint_least32_t ( &storage ) [ 2 * n ], std::size_t j )
+        {
+            return ( static_cast<std::uint64_t> ( storage [ 2 * j + 1 ] ) << 32 )
+                + static_cast<std::uint64_t> ( storage [ 2 * j ] );
+        }
+
+#if defined(__AVX2__)
+        // The low 64 bits of the lane-wise products of x and c. AVX2 has no
+        // 64-bit multiply, it's composed of three 32 x 32 -> 64 bit ones.
+        inline __m256i mullo_epi64 ( __m256i x, std::uint64_t c ) noexcept
+        {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+            return _mm256_mullo_epi64 ( x, _mm256_set1_epi64x ( static_cast<long long> ( c ) ) );
+#else
+            const __m256i c_lo = _mm256_set1_epi64x ( static_cast<long long> ( c & 0xFFFFFFFF ) );
+            const __m256i c_hi = _mm256_set1_epi64x ( static_cast<long long> ( c >> 32 ) );
+            const __m256i cross = _mm256_add_epi64 ( _mm256_mul_epu32 ( _mm256_srli_epi64 ( x, 32 ), c_lo ),
+                                                     _mm256_mul_epu32 ( x, c_hi ) );
+            return _mm256_add_epi64 ( _mm256_mul_epu32 ( x, c_lo ), _mm256_slli_epi64 ( cross, 32 ) );
+#endif
+        }
+#endif
+
+        /**
+        * The splitmix64 state updates and output hashes of @c size
+        * consecutive values, one per lane. The AVX-512 variant uses 8 lanes
+        * and vpmullq, the AVX2 variant 4 lanes and the composed multiply.
+        */
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+#define BOOST_RANDOM_SPLITMIX64_LANES
+        struct splitmix64_lanes
+        {
+            typedef __m512i type;
+            static const std::size_t size = 8;
+
+            // The states s + gamma, s + 2 * gamma, ... s + 8 * gamma.
+            static type first ( std::uint64_t s, std::uint64_t gamma ) noexcept
+            {
+                const __m512i j = _mm512_set_epi64 ( 8, 7, 6, 5, 4, 3, 2, 1 );
+                return _mm512_add_epi64 ( _mm512_set1_epi64 ( static_cast<long long> ( s ) ),
+                    _mm512_mullo_epi64 ( j, _mm512_set1_epi64 ( static_cast<long long> ( gamma ) ) ) );
+            }
+
+            static type step ( std::uint64_t gamma ) noexcept
+            { return _mm512_set1_epi64 ( static_cast<long long> ( size * gamma ) ); }
+
+            static type add ( type a, type b ) noexcept
+            { return _mm512_add_epi64 ( a, b ); }
+
+            static type hash ( type z ) noexcept
+            {
+                z = _mm512_mullo_epi64 ( _mm512_xor_si512 ( z, _mm512_srli_epi64 ( z, 30 ) ), _mm512_set1_epi64 ( static_cast<long long> ( 0xBF58476D1CE4E5B9 ) ) );
+                z = _mm512_mullo_epi64 ( _mm512_xor_si512 ( z, _mm512_srli_epi64 ( z, 27 ) ), _mm512_set1_epi64 ( static_cast<long long> ( 0x94D049BB133111EB ) ) );
+                return _mm512_xor_si512 ( z, _mm512_srli_epi64 ( z, 31 ) );
+            }
+
+            static void store ( void* p, type z ) noexcept
+            { _mm512_store_si512 ( p, z ); }
+        };
+#elif defined(__AVX2__)
+#define BOOST_RANDOM_SPLITMIX64_LANES
+        struct splitmix64_lanes
+        {
+            typedef __m256i type;
+            static const std::size_t size = 4;
+
+            // The states s + gamma, s + 2 * gamma, s + 3 * gamma, s + 4 * gamma.
+            static type first ( std::uint64_t s, std::uint64_t gamma ) noexcept
+            {
+                return _mm256_add_epi64 ( _mm256_set1_epi64x ( static_cast<long long> ( s ) ),
+                    _mm256_set_epi64x ( static_cast<long long> ( 4 * gamma ), static_cast<long long> ( 3 * gamma ),
+                                        static_cast<long long> ( 2 * gamma ), static_cast<long long> ( gamma ) ) );
+            }
+
+            static type step ( std::uint64_t gamma ) noexcept
+            { return _mm256_set1_epi64x ( static_cast<long long> ( size * gamma ) ); }
+
+            static type add ( type a, type b ) noexcept
+            { return _mm256_add_epi64 ( a, b ); }
+
+            static type hash ( type z ) noexcept
+            {
+                z = mullo_epi64 ( _mm256_xor_si256 ( z, _mm256_srli_epi64 ( z, 30 ) ), std::uint64_t { 0xBF58476D1CE4E5B9 } );
+                z = mullo_epi64 ( _mm256_xor_si256 ( z, _mm256_srli_epi64 ( z, 27 ) ), std::uint64_t { 0x94D049BB133111EB } );
+                return _mm256_xor_si256 ( z, _mm256_srli_epi64 ( z, 31 ) );
+            }
+
+            static void store ( void* p, type z ) noexcept
+            { _mm256_store_si256 ( static_cast<__m256i*> ( p ), z ); }
+        };
+#endif
+
+        // Access to the state of the engines, used by seed_many().
+        template<class Engine>
+        struct engine_access;
+
+        // Access to the state of the engines, used by binary_state.hpp.
+        template<class Engine>
+        struct binary_state_access;
+
+        // Selects the constructor of the xoroshiro128 engines from a state.
+        struct engine_state_tag { };
+
+        /**
+         * Output iterator folding the values written to it into a seed, used to
+         * consume @c seq.param() without buffering it. The state is held by
+         * reference, as @c param() takes its iterator by value.
+         */
+        class param_hash_iterator
+        {
+        public:
+            typedef std::output_iterator_tag iterator_category;
+            typedef void value_type;
+            typedef void difference_type;
+            typedef void pointer;
+            typedef void reference;
+
+            param_hash_iterator(std::uint64_t& seed, int& shift) noexcept
+                : _seed(&seed), _shift(&shift) { }
+
+            template<class T>
+            param_hash_iterator& operator=(const T& value) noexcept
+            {
+                // The values were stored as int, i.e. sign-extended, keep it so.
+                *_seed ^= detail::xoroshiro_integer_hash((static_cast<std::uint64_t>(static_cast<int>(value))
+                    << (*_shift ^= int { 32 })) ^ *_seed);
+                return *this;
+            }
+
+            param_hash_iterator& operator*() noexcept { return *this; }
+            param_hash_iterator& operator++() noexcept { return *this; }
+            param_hash_iterator& operator++(int) noexcept { return *this; }
+
+        private:
+            std::uint64_t* _seed;
+            int* _shift;
+        };
+
+        /**
+         * True if seeding from a @c SeedSeq cannot throw, i.e. if its
+         * @c generate() and @c param() are noexcept for the iterators the
+         * engines pass them (f.e. seed_seq_fe, but not std::seed_seq).
+         */
+        template<class SeedSeq>
+        struct seed_seq_is_nothrow : std::integral_constant<bool,
+            noexcept ( std::declval<SeedSeq&> ( ).generate ( std::declval<std::uint_least32_t*> ( ), std::declval<std::uint_least32_t*> ( ) ) ) &&
+            noexcept ( std::declval<SeedSeq&> ( ).param ( std::declval<param_hash_iterator> ( ) ) )> { };
+
+        template<class SeedSeq, std::size_t n>
+        BOOST_CXX14_CONSTEXPR void seed_array_uint64 ( SeedSeq& seq, std::uint64_t ( &x ) [ n ] )
+            noexcept ( seed_seq_is_nothrow<SeedSeq>::value )
+        {
+            std::uint_least32_t storage [ 2 * n ] = { };
+            seq.generate ( storage, storage + 2 * n );
+            for ( std::size_t j = 0; j < n; ++j ) {
+                x [ j ] = pack_seed_words<n> ( storage, j );
+            }
+        }
     }
 
     /**
@@ -47,6 +241,10 @@ namespace random {
     * It is a very fast generator passing BigCrush, and it can be useful if
     * for some reason one absolutely want 64 bits of state;
     *
+    * A seeded @c splitmix64 uses the fixed increment (gamma) 0x9E3779B97F4A7C15,
+    * the generators returned by split() use an increment of their own, as
+    * in SplittableRandom.
+    *
     * c-code by Sebastiano Vigna: http://xoroshiro.di.unimi.it/splitmix64.c
     */
     class splitmix64 {
@@ -62,12 +260,12 @@ namespace random {
 
         // Required for old Boost.Random concept.
         static const bool has_fixed_range = true;
-        static const std::uint64_t default_seed = std::uint64_t { 0x9E3779B97F4A7C15 };
+        static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = std::uint64_t { 0x9E3779B97F4A7C15 };
 
         /**
         * Constructs a @c splitmix64, using the default seed.
         */
-        splitmix64 ( )
+        BOOST_CXX14_CONSTEXPR splitmix64 ( )
         {
             seed ( );
         }
@@ -75,7 +273,7 @@ namespace random {
         /**
         * Constructs a @c splitmix64, seeding it with @c value.
         */
-        BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( splitmix64,
+        BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( splitmix64,
             std::uint64_t, value )
         {
             seed ( value );
@@ -85,7 +283,7 @@ namespace random {
         * Constructs a @c splitmix64, seeding it with values
         * produced by a call to @c seq.generate().
         */
-        BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR ( splitmix64,
+        BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR ( splitmix64,
             SeedSeq, seq )
         {
             seed ( seq );
@@ -110,7 +308,7 @@ namespace random {
         /**
         * Calls seed(default_seed).
         */
-        void seed ( )
+        BOOST_CXX14_CONSTEXPR void seed ( )
         {
             seed ( default_seed );
         }
@@ -128,17 +326,21 @@ namespace random {
         *	   return x;
         * }
         */
-        BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( splitmix64, std::uint64_t, value )
+        BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( splitmix64, std::uint64_t, value )
         {
+            BOOST_RANDOM_DETAIL_INSTRUMENT ( splitmix64, reseeds, 1 );
             _s [ 0 ] = detail::xoroshiro_integer_hash ( value );
+            _gamma = golden_gamma;
         }
 
         /**
         * Seeds a @c splitmix64 using values from a SeedSeq.
         */
-        BOOST_RANDOM_DETAIL_SEED_SEQ_SEED ( splitmix64, SeedSeq, seq )
+        BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED ( splitmix64, SeedSeq, seq )
         {
-            detail::seed_array_int<64, 1, SeedSeq, std::uint64_t> ( seq, _s );
+            BOOST_RANDOM_DETAIL_INSTRUMENT ( splitmix64, reseeds, 1 );
+            detail::seed_array_uint64 ( seq, _s );
+            _gamma = golden_gamma;
         }
 
         /**
@@ -152,14 +354,16 @@ namespace random {
         template<class It>
         void seed ( It& first, It last )
         {
+            BOOST_RANDOM_DETAIL_INSTRUMENT ( splitmix64, reseeds, 1 );
             detail::fill_array_int<64, 1, It, std::uint64_t> ( first, last, _s );
+            _gamma = golden_gamma;
         }
 
         /**
         * Returns the smallest value that the @c splitmix64
         * can produce.
         */
-        static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+        static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
         {
             return 0;
         }
@@ -168,63 +372,146 @@ namespace random {
         * Returns the largest value that the @c splitmix64
         * can produce.
         */
-        static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+        static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
         {
             return UINT64_MAX;
         }
 
         /** Returns the next value of the @c splitmix64. */
-        std::uint64_t operator()( )
+        BOOST_CXX14_CONSTEXPR std::uint64_t operator()( )
         {
+            BOOST_RANDOM_DETAIL_INSTRUMENT ( splitmix64, values, 1 );
             return hash ( next ( ) );
         }
 
-        /** Fills a range with random values. */
+        /**
+        * Fills a range with random 32-bit values, as
+        * detail::generate_from_int() does (the low word of each
+        * value first). SIMD builds compute 4 (AVX2) or 8 (AVX-512)
+        * values at a time.
+        */
         template<class Iter>
         void generate ( Iter first, Iter last )
         {
-            detail::generate_from_int ( *this, first, last );
+            BOOST_RANDOM_DETAIL_INSTRUMENT ( splitmix64, bulk_calls, 1 );
+            const std::size_t n = static_cast<std::size_t> ( std::distance ( first, last ) );
+            BOOST_RANDOM_DETAIL_INSTRUMENT ( splitmix64, values, n / 2 );
+            first = fill<true> ( _s [ 0 ], _gamma, first, n / 2 );
+            if ( n & 1 ) {
+                *first = static_cast<std::uint32_t> ( ( *this ) ( ) );
+            }
         }
 
-        /** Advances the state of the generator by @c z. */
-        void discard ( boost::uintmax_t z )
+        /**
+        * Advances the state of the generator by @c z. The state is a
+        * counter, this is a single multiply-add.
+        */
+        BOOST_CXX14_CONSTEXPR void discard ( boost::uintmax_t z )
         {
-            // This seems to be the fastest way (release),
-            // as opposed to anything more fancy.
-            while ( z-- ) {
-                next ( );
-            }
+            _s [ 0 ] += static_cast<std::uint64_t> ( z ) * _gamma;
+        }
+
+        /**
+        * Splits off a new @c splitmix64, as SplittableRandom.split() does:
+        * the state of the new generator is the next value of this one, its
+        * gamma is derived from the state after that. Advances this
+        * generator by 2. The generators are (statistically) independent,
+        * f.e. each task spawned in a fork-join tree can split off its own
+        * generator in O(1), without coordination.
+        */
+        BOOST_CXX14_CONSTEXPR splitmix64 split ( )
+        {
+            splitmix64 child ( *this );
+            child._s [ 0 ] = ( *this ) ( );
+            child._gamma = mix_gamma ( next ( ) );
+            return child;
+        }
+
+        /**
+        * Returns the value at position @c index of the stream of a
+        * @c splitmix64 seeded with @c key, i.e. the value returned by the
+        * first call to operator() after @c splitmix64(key).discard(index).
+        * The values are independent of each other, f.e. threads (or nodes)
+        * can compute (reproducible) disjoint parts of one stream, without
+        * communicating.
+        */
+        static BOOST_CXX14_CONSTEXPR std::uint64_t at ( std::uint64_t key, std::uint64_t index )
+        {
+            return hash ( detail::xoroshiro_integer_hash ( key ) + ( index + 1 ) * golden_gamma );
         }
 
-        friend bool operator==( const splitmix64& x,
+        /**
+        * Writes the values at positions [first_index, first_index + n) of
+        * the stream of a @c splitmix64 seeded with @c key to @c out, i.e.
+        * at(key, first_index), at(key, first_index + 1), .... SIMD builds
+        * compute 4 (AVX2) or 8 (AVX-512) values at a time.
+        */
+        template<class OutputIt>
+        static void generate_at ( std::uint64_t key, std::uint64_t first_index, OutputIt out, std::size_t n )
+        {
+            std::uint64_t s = detail::xoroshiro_integer_hash ( key ) + first_index * golden_gamma;
+            fill<false> ( s, golden_gamma, out, n );
+        }
+
+        friend BOOST_CXX14_CONSTEXPR bool operator==( const splitmix64& x,
             const splitmix64& y )
         {
-            return x._s [ 0 ] == y._s [ 0 ];
+            return x._s [ 0 ] == y._s [ 0 ] && x._gamma == y._gamma;
         }
 
-        friend bool operator!=( const splitmix64& x,
+        friend BOOST_CXX14_CONSTEXPR bool operator!=( const splitmix64& x,
             const splitmix64& y )
         {
             return !( x == y );
         }
 
-        /** Writes a @c splitmix64 to a @c std::ostream. */
+        /**
+        * Writes a @c splitmix64 to a @c std::ostream: the state, followed
+        * by the marker 'g' and the gamma if the gamma is not the default
+        * one. A @c splitmix64 with the default gamma is written as the
+        * state alone, the format of the splitmix64 with a fixed gamma.
+        */
         template<class CharT, class Traits>
         friend std::basic_ostream<CharT, Traits>&
             operator<<( std::basic_ostream<CharT, Traits>& os,
                 const splitmix64& sm64 )
         {
             os << sm64._s [ 0 ];
+            if ( sm64._gamma != golden_gamma ) {
+                os << ' ' << 'g' << sm64._gamma;
+            }
             return os;
         }
 
-        /** Reads a @c splitmix64 from a @c std::istream. */
+        /**
+        * Reads a @c splitmix64 from a @c std::istream, in the format of
+        * operator<<: a state not followed by the marker 'g' gets the
+        * default gamma, so a stream of the splitmix64 with a fixed gamma
+        * reads as well. An even gamma sets failbit, @c sm64 is unchanged
+        * then.
+        */
         template<class CharT, class Traits>
         friend std::basic_istream<CharT, Traits>&
             operator >> ( std::basic_istream<CharT, Traits>& is,
                 splitmix64& sm64 )
         {
-            is >> sm64._s [ 0 ];
+            std::uint64_t s = 0, gamma = golden_gamma;
+            if ( !( is >> s ) ) {
+                return is;
+            }
+            // At the end of the stream, ws and peek() would fail it.
+            if ( !is.eof ( ) && ( is >> std::ws, !is.eof ( ) ) &&
+                Traits::eq_int_type ( is.peek ( ), Traits::to_int_type ( is.widen ( 'g' ) ) ) ) {
+                is.get ( );
+                if ( !( is >> gamma ) ) {
+                    return is;
+                }
+                if ( !( gamma & 1 ) ) {
+                    is.setstate ( std::ios_base::failbit );
+                    return is;
+                }
+            }
+            sm64._s [ 0 ] = s, sm64._gamma = gamma;
             return is;
         }
 
@@ -232,71 +519,142 @@ namespace random {
 
         /// \cond show_private
 
-        std::uint64_t next ( )
+        template<class Engine>
+        friend struct detail::binary_state_access;
+        BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME ( splitmix64, "splitmix64" )
+
+        static BOOST_CONSTEXPR_OR_CONST std::uint64_t golden_gamma = std::uint64_t { 0x9E3779B97F4A7C15 };
+
+        BOOST_CXX14_CONSTEXPR std::uint64_t next ( )
         {
-            return ( _s [ 0 ] += std::uint64_t { 0x9E3779B97F4A7C15 } );
+            return ( _s [ 0 ] += _gamma );
         }
 
-        static std::uint64_t hash ( std::uint64_t z )
+        static BOOST_CXX14_CONSTEXPR int popcount ( std::uint64_t x )
+        {
+            x -= ( x >> 1 ) & std::uint64_t { 0x5555555555555555 };
+            x = ( x & std::uint64_t { 0x3333333333333333 } ) + ( ( x >> 2 ) & std::uint64_t { 0x3333333333333333 } );
+            x = ( x + ( x >> 4 ) ) & std::uint64_t { 0x0F0F0F0F0F0F0F0F };
+            return static_cast<int> ( ( x * std::uint64_t { 0x0101010101010101 } ) >> 56 );
+        }
+
+        // SplittableRandom.mixGamma(), an odd gamma with enough bit transitions.
+        static BOOST_CXX14_CONSTEXPR std::uint64_t mix_gamma ( std::uint64_t z )
+        {
+            z = ( z ^ ( z >> 33 ) ) * std::uint64_t { 0xFF51AFD7ED558CCD };
+            z = ( z ^ ( z >> 33 ) ) * std::uint64_t { 0xC4CEB9FE1A85EC53 };
+            z = ( z ^ ( z >> 33 ) ) | std::uint64_t { 1 };
+            return popcount ( z ^ ( z >> 1 ) ) < 24 ? z ^ std::uint64_t { 0xAAAAAAAAAAAAAAAA } : z;
+        }
+
+        static BOOST_CXX14_CONSTEXPR std::uint64_t hash ( std::uint64_t z )
         {
             z = ( z ^ ( z >> 30 ) ) * std::uint64_t { 0xBF58476D1CE4E5B9 };
             z = ( z ^ ( z >> 27 ) ) * std::uint64_t { 0x94D049BB133111EB };
             return z ^ ( z >> 31 );
         }
 
+        /**
+        * Writes the @c n values following state @c s (advancing @c s) to
+        * @c out, as 64-bit values or, if @c Words, as pairs of 32-bit
+        * words, low word first.
+        */
+        template<bool Words, class OutputIt>
+        static OutputIt fill ( std::uint64_t& s, std::uint64_t gamma, OutputIt out, std::size_t n )
+        {
+#if defined(BOOST_RANDOM_SPLITMIX64_LANES)
+            typedef detail::splitmix64_lanes lanes;
+            if ( n >= lanes::size ) {
+                typename lanes::type z = lanes::first ( s, gamma );
+                const typename lanes::type step = lanes::step ( gamma );
+                // The lanes stored as 64-bit values or (little endian) as
+                // their 32-bit words.
+                BOOST_ALIGNMENT ( 64 ) std::uint64_t values [ lanes::size ];
+                BOOST_ALIGNMENT ( 64 ) std::uint32_t words [ 2 * lanes::size ];
+                for ( ; n >= lanes::size; n -= lanes::size ) {
+                    if ( Words ) {
+                        lanes::store ( words, lanes::hash ( z ) );
+                        out = std::copy ( words, words + 2 * lanes::size, out );
+                    }
+                    else {
+                        lanes::store ( values, lanes::hash ( z ) );
+                        out = std::copy ( values, values + lanes::size, out );
+                    }
+                    z = lanes::add ( z, step );
+                    s += lanes::size * gamma;
+                }
+            }
+#endif
+            for ( ; n; --n ) {
+                const std::uint64_t v = hash ( s += gamma );
+                if ( Words ) {
+                    *out = static_cast<std::uint32_t> ( v );
+                    ++out;
+                    *out = static_cast<std::uint32_t> ( v >> 32 );
+                }
+                else {
+                    *out = v;
+                }
+                ++out;
+            }
+            return out;
+        }
+
         /// \endcond
 
-        std::uint64_t _s [ 1 ];
+        std::uint64_t _s [ 1 ] = { };
+        std::uint64_t _gamma = golden_gamma;
     };
 
 namespace detail {
 
-    // const std::uint64_t v = 0x1AEC805299990163, y = 0xCDFB859A3DD0884B;
-
-    std::uint64_t xoroshiro_integer_hash(std::uint64_t x)
-    {
-        x = ((x >> 32) ^ x) * std::uint64_t { 0x1AEC805299990163 };
-        x = ((x >> 32) ^ x);
-        return x;
-    }
+    template<class SeedSeq, std::size_t n>
+    void seed_array_non_zero_fallback(SeedSeq &seq, std::uint64_t (&x)[n])
+        noexcept(seed_seq_is_nothrow<SeedSeq>::value);
 
+    /**
+     * Fills @c x from @c seq.generate(). If that yields an all-zero state,
+     * the state is derived from @c seq.param() instead, without allocating.
+     */
     template<class SeedSeq, std::size_t n>
-    void seed_array_non_zero_int(SeedSeq &seq, std::uint64_t (&x)[n])
+    BOOST_CXX14_CONSTEXPR void seed_array_non_zero_int(SeedSeq &seq, std::uint64_t (&x)[n])
+        noexcept(seed_seq_is_nothrow<SeedSeq>::value)
     {
-        std::uint_least32_t storage[2 * n];
-        seq.generate(std::begin(storage), std::end(storage));
+        std::uint_least32_t storage[2 * n] = { };
+        seq.generate(storage, storage + 2 * n);
 
         std::size_t j = 0;
         for (; j < n; ++j) {
-            x[j] = (static_cast<std::uint64_t>(storage[2 * j + 1]) << 32)
-                + static_cast<std::uint64_t>(storage [2 * j]);
+            x[j] = pack_seed_words<n>(storage, j);
             if (x[j]) {
                 // non-zero seed detected, carry on, without checking...
                 ++j;
                 for (; j < n; ++j) {
-                    x[j] = (static_cast<std::uint64_t>(storage[2 * j + 1]) << 32)
-                        + static_cast<std::uint64_t>(storage[2 * j]);
+                    x[j] = pack_seed_words<n>(storage, j);
                 }
                 return;
             }
         }
 
+        seed_array_non_zero_fallback(seq, x);
+    }
+
+    template<class SeedSeq, std::size_t n>
+    void seed_array_non_zero_fallback(SeedSeq &seq, std::uint64_t (&x)[n])
+        noexcept(seed_seq_is_nothrow<SeedSeq>::value)
+    {
         // Fix zeros, generating some kind of seed from the
-        // SeedSeq, subsequently use this seed for the seeding
-        // of boost::random::splitmix64.
+        // SeedSeq, subsequently use the stream of a
+        // boost::random::splitmix64 seeded with it (through at(),
+        // which does not count as use of a splitmix64).
         std::uint64_t seed = 0;
-
-        std::vector<int> v;
-        v.reserve(seq.size());
-        seq.param(std::back_inserter(v));
         int shift = 32;
 
-        for (auto i : v) {
-            seed ^= detail::xoroshiro_integer_hash((static_cast<std::uint64_t>(i) << (shift ^= int { 32 })) ^ seed);
-        }
+        seq.param(param_hash_iterator(seed, shift));
 
-        boost::random::splitmix64 gen(seed);
-        std::generate(std::begin(x), std::end(x), gen);
+        for (std::size_t j = 0; j < n; ++j) {
+            x[j] = splitmix64::at(seed, j);
+        }
     }
 
     template<class It, std::size_t n>
@@ -325,9 +683,10 @@ namespace detail {
             }
         }
 
-        // Fix zeros.
-        boost::random::splitmix64 gen;
-        std::generate(std::begin(x), std::end(x), gen);
+        // Fix zeros, the stream of a default seeded splitmix64.
+        for (j = 0; j < n; ++j) {
+            x[j] = splitmix64::at(splitmix64::default_seed, j);
+        }
     }
 
 } // namespace detail
@@ -364,18 +723,18 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
      * Constructs a @c xoroshiro128plus, using the default seed.
      */
-    xoroshiro128plus()
+    BOOST_CXX14_CONSTEXPR xoroshiro128plus()
     { seed(); }
 
     /**
      * Constructs a @c xoroshiro128plus, seeding it with @c value.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xoroshiro128plus,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xoroshiro128plus,
                                                std::uint64_t, value)
     { seed(value); }
 
@@ -383,7 +742,7 @@ public:
      * Constructs a @c xoroshiro128plus, seeding it with values
      * produced by a call to @c seq.generate().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(xoroshiro128plus,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR(xoroshiro128plus,
                                              SeedSeq, seq)
     { seed(seq); }
 
@@ -404,26 +763,28 @@ public:
     /**
      * Calls seed(default_seed)
      */
-    void seed()
+    BOOST_CXX14_CONSTEXPR void seed()
     { seed(default_seed); }
 
     /**
      * seeds a @c xoroshiro128plus with splitmix64, as per Sebastiano
      * Vigna's recommendation.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xoroshiro128plus, std::uint64_t, value)
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xoroshiro128plus, std::uint64_t, value)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoroshiro128plus, reseeds, 1);
         std::uint64_t s = value + std::uint64_t { 0x9E3779B97F4A7C15 };
         _s[0] = detail::xoroshiro_integer_hash (s);
         _s[1] = detail::xoroshiro_integer_hash ((s += std::uint64_t { 0x9E3779B97F4A7C15 }));
     }
 
     /**
-     * Seeds a @c xoroshiro128plus using values from a SeedSeq. If a
-     * valid seed cannot be generated throws @c std::runtime_error.
+     * Seeds a @c xoroshiro128plus using values from a SeedSeq. An
+     * all-zero state is replaced by one derived from @c seq.param().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(xoroshiro128plus, SeedSeq, seq)
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED(xoroshiro128plus, SeedSeq, seq)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoroshiro128plus, reseeds, 1);
         detail::seed_array_non_zero_int(seq, _s);
         warmup();
     }
@@ -440,6 +801,7 @@ public:
     template<class It>
     void seed(It& first, It last)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoroshiro128plus, reseeds, 1);
         detail::fill_array_non_zero_int(first, last, _s);
         warmup();
     }
@@ -448,19 +810,20 @@ public:
      * Returns the smallest value that the @c xoroshiro128plus
      * can produce.
      */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return 0; }
 
     /**
      * Returns the largest value that the @c xoroshiro128plus
      * can produce.
      */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return UINT64_MAX; }
 
     /** Returns the next value of the @c xoroshiro128plus. */
-    std::uint64_t operator()()
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()()
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoroshiro128plus, values, 1);
         std::uint64_t r = _s[0] + _s[1];
         next();
         return r;
@@ -469,10 +832,13 @@ public:
     /** Fills a range with random values. */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoroshiro128plus, bulk_calls, 1);
+        detail::generate_from_int(*this, first, last);
+    }
 
     /** Advances the state of the generator by @c z. */
-    void discard(std::uintmax_t z)
+    BOOST_CXX14_CONSTEXPR void discard(std::uintmax_t z)
     {
         while (z--) {
             next();
@@ -485,8 +851,9 @@ public:
      * generate 2^64 non-overlapping subsequences for parallel
      * computations.
      */
-    void jump(std::uintmax_t z = 1)
+    BOOST_CXX14_CONSTEXPR void jump(std::uintmax_t z = 1)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoroshiro128plus, jumps, z);
         while(z--) {
             std::uint64_t s0 = 0, s1 = 0;
             for (std::size_t b = 0; b < 64; ++b ) {
@@ -505,11 +872,30 @@ public:
         }
     }
 
-    friend bool operator==(const xoroshiro128plus& x,
+    /**
+     * Splits off a new @c xoroshiro128plus, seeded by a splitmix64 which is seeded
+     * with the next value of this generator (which advances by 1). As
+     * with splitmix64::split(), f.e. each task spawned in a fork-join tree
+     * can split off its own generator in O(1), without coordination. Use
+     * jump() instead, where non-overlapping sequences are required.
+     */
+    BOOST_CXX14_CONSTEXPR xoroshiro128plus split()
+    {
+        // Consecutive values of a splitmix64 differ, the state of the
+        // child is not all-zero.
+        const std::uint64_t key = (*this)();
+        xoroshiro128plus child(*this);
+        for (std::size_t i = 0; i < sizeof(_s) / sizeof(_s[0]); ++i) {
+            child._s[i] = splitmix64::at(key, i);
+        }
+        return child;
+    }
+
+    friend BOOST_CXX14_CONSTEXPR bool operator==(const xoroshiro128plus& x,
                            const xoroshiro128plus& y)
     { return x._s[0] == y._s[0] && x._s[1] == y._s[1]; }
 
-    friend bool operator!=(const xoroshiro128plus& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=(const xoroshiro128plus& x,
                            const xoroshiro128plus& y)
     { return !(x == y); }
 
@@ -537,12 +923,23 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(xoroshiro128plus, "xoroshiro128plus")
+
+    // Constructs the engine with state (s0, s1) as is, without warmup,
+    // used by engine_bank.
+    BOOST_CXX14_CONSTEXPR xoroshiro128plus(detail::engine_state_tag, std::uint64_t s0, std::uint64_t s1)
+    { _s[0] = s0, _s[1] = s1; }
+
     // Rotate left, use of intrinsic shows no speed-up. */
-    static std::uint64_t rotl(const std::uint64_t x, const int k)
+    static BOOST_CXX14_CONSTEXPR std::uint64_t rotl(const std::uint64_t x, const int k)
     { return (x << k) | (x >> (64 - k)); }
 
     /** Advance the state by 1 step. */
-    void next()
+    BOOST_CXX14_CONSTEXPR void next()
     {
         _s[1] ^= _s [0];
         _s[0] = rotl(_s[0], 55);
@@ -552,14 +949,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup()
+    BOOST_CXX14_CONSTEXPR void warmup()
     {
         discard(8);
     }
 
     /// \endcond
 
-    std::uint64_t _s[2];
+    std::uint64_t _s[2] = { };
 };
 
 /**
@@ -592,18 +989,18 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
      * Constructs a @c xoshiro256starstar, using the default seed.
      */
-    xoshiro256starstar()
+    BOOST_CXX14_CONSTEXPR xoshiro256starstar()
     { seed(); }
 
     /**
      * Constructs a @c xoshiro256starstar, seeding it with @c value.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xoshiro256starstar,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xoshiro256starstar,
                                                std::uint64_t, value)
     { seed(value); }
 
@@ -611,7 +1008,7 @@ public:
      * Constructs a @c xoshiro256starstar, seeding it with values
      * produced by a call to @c seq.generate().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(xoshiro256starstar,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR(xoshiro256starstar,
                                              SeedSeq, seq)
     { seed(seq); }
 
@@ -632,15 +1029,16 @@ public:
     /**
      * Calls seed(default_seed)
      */
-    void seed()
+    BOOST_CXX14_CONSTEXPR void seed()
     { seed(default_seed); }
 
     /**
      * seeds a @c xoshiro256starstar with splitmix64, as per Sebastiano
      * Vigna's recommendation.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xoshiro256starstar, std::uint64_t, value)
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xoshiro256starstar, std::uint64_t, value)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, reseeds, 1);
         std::uint64_t s = value + std::uint64_t ( 0x9E3779B97F4A7C15 );
         _s[0] = detail::xoroshiro_integer_hash(s);
         _s[1] = detail::xoroshiro_integer_hash((s += std::uint64_t { 0x9E3779B97F4A7C15 }));
@@ -649,11 +1047,12 @@ public:
     }
 
     /**
-     * Seeds a @c xoshiro256starstar using values from a SeedSeq. If a
-     * valid seed cannot be generated throws @c std::runtime_error.
+     * Seeds a @c xoshiro256starstar using values from a SeedSeq. An
+     * all-zero state is replaced by one derived from @c seq.param().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(xoshiro256starstar, SeedSeq, seq)
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED(xoshiro256starstar, SeedSeq, seq)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, reseeds, 1);
         detail::seed_array_non_zero_int(seq, _s);
         warmup();
     }
@@ -670,6 +1069,7 @@ public:
     template<class It>
     void seed(It& first, It last)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, reseeds, 1);
         detail::fill_array_non_zero_int(first, last, _s);
         warmup();
     }
@@ -678,19 +1078,20 @@ public:
      * Returns the smallest value that the @c xoshiro256starstar
      * can produce.
      */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return 0; }
 
     /**
      * Returns the largest value that the @c xoshiro256starstar
      * can produce.
      */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return UINT64_MAX; }
 
     /** Returns the next value of the @c xoshiro256starstar. */
-    std::uint64_t operator()()
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()()
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, values, 1);
         const std::uint64_t r = rotl ( _s[1] * 5, 7 ) * 9;
         next();
         return r;
@@ -699,10 +1100,13 @@ public:
     /** Fills a range with random values. */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, bulk_calls, 1);
+        detail::generate_from_int(*this, first, last);
+    }
 
     /** Advances the state of the generator by @c z. */
-    void discard(std::uintmax_t z)
+    BOOST_CXX14_CONSTEXPR void discard(std::uintmax_t z)
     {
         while (z--) {
             next();
@@ -714,9 +1118,10 @@ public:
      * to 2^128 calls to next() @c z times; it can be used to generate
      * 2^128 non-overlapping subsequences for parallel computations.
      */
-    void jump(std::uintmax_t z = 1)
+    BOOST_CXX14_CONSTEXPR void jump(std::uintmax_t z = 1)
     {
-        static const std::uint64_t JUMP[4] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, jumps, z);
+        const std::uint64_t JUMP[4] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
         while(z--) {
             std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
             for ( int i = 0; i < sizeof JUMP / sizeof *JUMP; i++ )
@@ -744,9 +1149,10 @@ public:
      * 2^64 non-overlapping subsequences for parallel distributed
      * computations.
      */
-    void long_jump()
+    BOOST_CXX14_CONSTEXPR void long_jump()
     {
-        static const std::uint64_t LONG_JUMP[4] = { 0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635 };
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256starstar, jumps, 1);
+        const std::uint64_t LONG_JUMP[4] = { 0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635 };
         std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
         for ( std::size_t i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; ++i )
             for ( std::size_t b = 0; b < std::size_t ( 64 ); ++b ) {
@@ -765,11 +1171,30 @@ public:
         _s[3] = s3;
     }
 
-    friend bool operator==(const xoshiro256starstar& x,
+    /**
+     * Splits off a new @c xoshiro256starstar, seeded by a splitmix64 which is seeded
+     * with the next value of this generator (which advances by 1). As
+     * with splitmix64::split(), f.e. each task spawned in a fork-join tree
+     * can split off its own generator in O(1), without coordination. Use
+     * jump() instead, where non-overlapping sequences are required.
+     */
+    BOOST_CXX14_CONSTEXPR xoshiro256starstar split()
+    {
+        // Consecutive values of a splitmix64 differ, the state of the
+        // child is not all-zero.
+        const std::uint64_t key = (*this)();
+        xoshiro256starstar child(*this);
+        for (std::size_t i = 0; i < sizeof(_s) / sizeof(_s[0]); ++i) {
+            child._s[i] = splitmix64::at(key, i);
+        }
+        return child;
+    }
+
+    friend BOOST_CXX14_CONSTEXPR bool operator==(const xoshiro256starstar& x,
                            const xoshiro256starstar& y)
     { return x._s[0] == y._s[0] && x._s[1] == y._s[1] && x._s [2] == y._s [2] && x._s [3] == y._s [3]; }
 
-    friend bool operator!=(const xoshiro256starstar& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=(const xoshiro256starstar& x,
                            const xoshiro256starstar& y)
     { return !(x == y); }
 
@@ -797,12 +1222,18 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(xoshiro256starstar, "xoshiro256starstar")
+
     // Rotate left, use of intrinsic shows no speed-up. */
-    static std::uint64_t rotl(const std::uint64_t x, const int k)
+    static BOOST_CXX14_CONSTEXPR std::uint64_t rotl(const std::uint64_t x, const int k)
     { return (x << k) | (x >> (64 - k)); }
 
     /** Advance the state by 1 step. */
-    void next()
+    BOOST_CXX14_CONSTEXPR void next()
     {
         const std::uint64_t t = _s[1] << 17;
 
@@ -817,14 +1248,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup()
+    BOOST_CXX14_CONSTEXPR void warmup()
     {
         discard(8);
     }
 
     /// \endcond
 
-    std::uint64_t _s[4];
+    std::uint64_t _s[4] = { };
 };
 
 
@@ -864,18 +1295,18 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
      * Constructs a @c xoshiro256plus, using the default seed.
      */
-    xoshiro256plus()
+    BOOST_CXX14_CONSTEXPR xoshiro256plus()
     { seed(); }
 
     /**
      * Constructs a @c xoshiro256plus, seeding it with @c value.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xoshiro256plus,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xoshiro256plus,
                                                std::uint64_t, value)
     { seed(value); }
 
@@ -883,7 +1314,7 @@ public:
      * Constructs a @c xoshiro256plus, seeding it with values
      * produced by a call to @c seq.generate().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(xoshiro256plus,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR(xoshiro256plus,
                                              SeedSeq, seq)
     { seed(seq); }
 
@@ -904,15 +1335,16 @@ public:
     /**
      * Calls seed(default_seed)
      */
-    void seed()
+    BOOST_CXX14_CONSTEXPR void seed()
     { seed(default_seed); }
 
     /**
      * seeds a @c xoshiro256plus with splitmix64, as per Sebastiano
      * Vigna's recommendation.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xoshiro256plus, std::uint64_t, value)
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xoshiro256plus, std::uint64_t, value)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, reseeds, 1);
         std::uint64_t s = value + std::uint64_t ( 0x9E3779B97F4A7C15 );
         _s[0] = detail::xoroshiro_integer_hash(s);
         _s[1] = detail::xoroshiro_integer_hash((s += std::uint64_t { 0x9E3779B97F4A7C15 }));
@@ -921,11 +1353,12 @@ public:
     }
 
     /**
-     * Seeds a @c xoshiro256plus using values from a SeedSeq. If a
-     * valid seed cannot be generated throws @c std::runtime_error.
+     * Seeds a @c xoshiro256plus using values from a SeedSeq. An
+     * all-zero state is replaced by one derived from @c seq.param().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(xoshiro256plus, SeedSeq, seq)
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED(xoshiro256plus, SeedSeq, seq)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, reseeds, 1);
         detail::seed_array_non_zero_int(seq, _s);
         warmup();
     }
@@ -942,6 +1375,7 @@ public:
     template<class It>
     void seed(It& first, It last)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, reseeds, 1);
         detail::fill_array_non_zero_int(first, last, _s);
         warmup();
     }
@@ -950,19 +1384,20 @@ public:
      * Returns the smallest value that the @c xoshiro256plus
      * can produce.
      */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return 0; }
 
     /**
      * Returns the largest value that the @c xoshiro256plus
      * can produce.
      */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return UINT64_MAX; }
 
     /** Returns the next value of the @c xoshiro256plus. */
-    std::uint64_t operator()()
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()()
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, values, 1);
         const std::uint64_t r = _s[0] + _s[3];
         next();
         return r;
@@ -971,10 +1406,13 @@ public:
     /** Fills a range with random values. */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, bulk_calls, 1);
+        detail::generate_from_int(*this, first, last);
+    }
 
     /** Advances the state of the generator by @c z. */
-    void discard(std::uintmax_t z)
+    BOOST_CXX14_CONSTEXPR void discard(std::uintmax_t z)
     {
         while (z--) {
             next();
@@ -986,9 +1424,10 @@ public:
      * to 2^128 calls to next() @c z times; it can be used to generate
      * 2^128 non-overlapping subsequences for parallel computations.
      */
-    void jump(std::uintmax_t z = 1)
+    BOOST_CXX14_CONSTEXPR void jump(std::uintmax_t z = 1)
     {
-        static const std::uint64_t JUMP[4] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, jumps, z);
+        const std::uint64_t JUMP[4] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
         while(z--) {
             std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
             for(std::size_t i = 0; i < sizeof JUMP / sizeof *JUMP; ++i)
@@ -1016,9 +1455,10 @@ public:
      * 2^64 non-overlapping subsequences for parallel distributed
      * computations.
      */
-    void long_jump()
+    BOOST_CXX14_CONSTEXPR void long_jump()
     {
-        static const std::uint64_t LONG_JUMP[] = { 0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635 };
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xoshiro256plus, jumps, 1);
+        const std::uint64_t LONG_JUMP[] = { 0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635 };
 
         std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
         for(std::size_t i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; ++i)
@@ -1038,11 +1478,11 @@ public:
         _s[3] = s3;
     }
 
-    friend bool operator==(const xoshiro256plus& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator==(const xoshiro256plus& x,
                            const xoshiro256plus& y)
     { return x._s[0] == y._s[0] && x._s[1] == y._s[1] && x._s [2] == y._s [2] && x._s [3] == y._s [3]; }
 
-    friend bool operator!=(const xoshiro256plus& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=(const xoshiro256plus& x,
                            const xoshiro256plus& y)
     { return !(x == y); }
 
@@ -1070,12 +1510,18 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(xoshiro256plus, "xoshiro256plus")
+
     // Rotate left, use of intrinsic shows no speed-up. */
-    static std::uint64_t rotl(const std::uint64_t x, const int k)
+    static BOOST_CXX14_CONSTEXPR std::uint64_t rotl(const std::uint64_t x, const int k)
     { return (x << k) | (x >> (64 - k)); }
 
     /** Advance the state by 1 step. */
-    void next()
+    BOOST_CXX14_CONSTEXPR void next()
     {
         const uint64_t t = _s[1] << 17;
 
@@ -1090,14 +1536,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup()
+    BOOST_CXX14_CONSTEXPR void warmup()
     {
         discard(8);
     }
 
     /// \endcond
 
-    std::uint64_t _s[4];
+    std::uint64_t _s[4] = { };
 };
 
 
@@ -1108,12 +1554,12 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
     * Constructs a @c xoroshiro128plusshixo, using the default seed.
     */
-    xoroshiro128plusshixo ( )
+    BOOST_CXX14_CONSTEXPR xoroshiro128plusshixo ( )
     {
         seed ( );
     }
@@ -1121,7 +1567,7 @@ public:
     /**
     * Constructs a @c xoroshiro128plusshixo, seeding it with @c value.
     */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( xoroshiro128plusshixo,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( xoroshiro128plusshixo,
         std::uint64_t, value )
     {
         seed ( value );
@@ -1131,7 +1577,7 @@ public:
     * Constructs a @c xoroshiro128plusshixo, seeding it with values
     * produced by a call to @c seq.generate().
     */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR ( xoroshiro128plusshixo,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR ( xoroshiro128plusshixo,
         SeedSeq, seq )
     {
         seed ( seq );
@@ -1156,7 +1602,7 @@ public:
     /**
     * Calls seed(default_seed)
     */
-    void seed ( )
+    BOOST_CXX14_CONSTEXPR void seed ( )
     {
         seed ( default_seed );
     }
@@ -1165,19 +1611,21 @@ public:
     * seeds a @c xoroshiro128plusshixo with splitmix64, as per Sebastiano
     * Vigna's recommendation.
     */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( xoroshiro128plusshixo, std::uint64_t, value )
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( xoroshiro128plusshixo, std::uint64_t, value )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixo, reseeds, 1 );
         std::uint64_t s = value + std::uint64_t { 0x9E3779B97F4A7C15 };
         _s [ 0 ] = detail::xoroshiro_integer_hash ( s );
         _s [ 1 ] = detail::xoroshiro_integer_hash ( ( s += std::uint64_t { 0x9E3779B97F4A7C15 } ) );
     }
 
     /**
-    * Seeds a @c xoroshiro128plusshixo using values from a SeedSeq. If a
-    * valid seed cannot be generated throws @c std::runtime_error.
+    * Seeds a @c xoroshiro128plusshixo using values from a SeedSeq. An
+    * all-zero state is replaced by one derived from @c seq.param().
     */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED ( xoroshiro128plusshixo, SeedSeq, seq )
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED ( xoroshiro128plusshixo, SeedSeq, seq )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixo, reseeds, 1 );
         detail::seed_array_non_zero_int ( seq, _s );
         warmup ( );
     }
@@ -1194,6 +1642,7 @@ public:
     template<class It>
     void seed ( It& first, It last )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixo, reseeds, 1 );
         detail::fill_array_non_zero_int ( first, last, _s );
         warmup ( );
     }
@@ -1202,7 +1651,7 @@ public:
     * Returns the smallest value that the @c xoroshiro128plusshixo
     * can produce.
     */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
     {
         return 0;
     }
@@ -1211,14 +1660,15 @@ public:
     * Returns the largest value that the @c xoroshiro128plusshixo
     * can produce.
     */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
     {
         return UINT64_MAX;
     }
 
     /** Returns the next value of the @c xoroshiro128plusshixo. */
-    std::uint64_t operator()( )
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()( )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixo, values, 1 );
         std::uint64_t r = _s[0] + _s [1];
         next ( );
         return ( r >> 32 ) ^ r;
@@ -1227,6 +1677,7 @@ public:
     /** Fills a range with random values. */
     template<class Iter>
     void generate ( Iter first, Iter last ) {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixo, bulk_calls, 1 );
 
         detail::generate_from_int ( *this, first, last );
 
@@ -1247,7 +1698,7 @@ public:
     }
 
     /** Advances the state of the generator by @c z. */
-    void discard ( std::uintmax_t z )
+    BOOST_CXX14_CONSTEXPR void discard ( std::uintmax_t z )
     {
         while ( z-- ) {
             next ( );
@@ -1260,8 +1711,9 @@ public:
     * generate 2^64 non-overlapping subsequences for parallel
     * computations.
     */
-    void jump ( std::uintmax_t z = 1 )
+    BOOST_CXX14_CONSTEXPR void jump ( std::uintmax_t z = 1 )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixo, jumps, z );
         while ( z-- ) {
             std::uint64_t s0 = 0, s1 = 0;
             for ( std::size_t b = 0; b < 64; ++b ) {
@@ -1280,13 +1732,13 @@ public:
         }
     }
 
-    friend bool operator==( const xoroshiro128plusshixo& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator==( const xoroshiro128plusshixo& x,
         const xoroshiro128plusshixo& y )
     {
         return x._s [ 0 ] == y._s [ 0 ] && x._s [ 1 ] == y._s [ 1 ];
     }
 
-    friend bool operator!=( const xoroshiro128plusshixo& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=( const xoroshiro128plusshixo& x,
         const xoroshiro128plusshixo& y )
     {
         return !( x == y );
@@ -1316,14 +1768,27 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME ( xoroshiro128plusshixo, "xoroshiro128plusshixo" )
+
+    // Constructs the engine with state (s0, s1) as is, without warmup,
+    // used by engine_bank.
+    BOOST_CXX14_CONSTEXPR xoroshiro128plusshixo ( detail::engine_state_tag, std::uint64_t s0, std::uint64_t s1 )
+    {
+        _s [ 0 ] = s0, _s [ 1 ] = s1;
+    }
+
     // Rotate left, use of intrinsic shows no speed-up. */
-    static std::uint64_t rotl ( const std::uint64_t x, const int k )
+    static BOOST_CXX14_CONSTEXPR std::uint64_t rotl ( const std::uint64_t x, const int k )
     {
         return ( x << k ) | ( x >> ( 64 - k ) );
     }
 
     /** Advance the state by 1 step. */
-    void next ( )
+    BOOST_CXX14_CONSTEXPR void next ( )
     {
         _s [ 1 ] ^= _s [ 0 ];
         _s [ 0 ] = rotl ( _s [ 0 ], 55 );
@@ -1333,14 +1798,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup ( )
+    BOOST_CXX14_CONSTEXPR void warmup ( )
     {
         discard ( 8 );
     }
 
     /// \endcond
 
-    std::uint64_t _s [ 2 ];
+    std::uint64_t _s [ 2 ] = { };
 };
 
 class xoroshiro128plusshixostar
@@ -1350,12 +1815,12 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
     * Constructs a @c xoroshiro128plusshixostar, using the default seed.
     */
-    xoroshiro128plusshixostar ( )
+    BOOST_CXX14_CONSTEXPR xoroshiro128plusshixostar ( )
     {
         seed ( );
     }
@@ -1363,7 +1828,7 @@ public:
     /**
     * Constructs a @c xoroshiro128plusshixostar, seeding it with @c value.
     */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( xoroshiro128plusshixostar,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( xoroshiro128plusshixostar,
         std::uint64_t, value )
     {
         seed ( value );
@@ -1373,7 +1838,7 @@ public:
     * Constructs a @c xoroshiro128plusshixostar, seeding it with values
     * produced by a call to @c seq.generate().
     */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR ( xoroshiro128plusshixostar,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR ( xoroshiro128plusshixostar,
         SeedSeq, seq )
     {
         seed ( seq );
@@ -1398,7 +1863,7 @@ public:
     /**
     * Calls seed(default_seed)
     */
-    void seed ( )
+    BOOST_CXX14_CONSTEXPR void seed ( )
     {
         seed ( default_seed );
     }
@@ -1407,19 +1872,21 @@ public:
     * seeds a @c xoroshiro128plusshixostar with splitmix64, as per Sebastiano
     * Vigna's recommendation.
     */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( xoroshiro128plusshixostar, std::uint64_t, value )
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( xoroshiro128plusshixostar, std::uint64_t, value )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostar, reseeds, 1 );
         std::uint64_t s = value + std::uint64_t { 0x9E3779B97F4A7C15 };
         _s [ 0 ] = detail::xoroshiro_integer_hash ( s );
         _s [ 1 ] = detail::xoroshiro_integer_hash ( ( s += std::uint64_t { 0x9E3779B97F4A7C15 } ) );
     }
 
     /**
-    * Seeds a @c xoroshiro128plusshixostar using values from a SeedSeq. If a
-    * valid seed cannot be generated throws @c std::runtime_error.
+    * Seeds a @c xoroshiro128plusshixostar using values from a SeedSeq. An
+    * all-zero state is replaced by one derived from @c seq.param().
     */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED ( xoroshiro128plusshixostar, SeedSeq, seq )
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED ( xoroshiro128plusshixostar, SeedSeq, seq )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostar, reseeds, 1 );
         detail::seed_array_non_zero_int ( seq, _s );
         warmup ( );
     }
@@ -1436,6 +1903,7 @@ public:
     template<class It>
     void seed ( It& first, It last )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostar, reseeds, 1 );
         detail::fill_array_non_zero_int ( first, last, _s );
         warmup ( );
     }
@@ -1444,7 +1912,7 @@ public:
     * Returns the smallest value that the @c xoroshiro128plusshixostar
     * can produce.
     */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
     {
         return 0;
     }
@@ -1453,14 +1921,15 @@ public:
     * Returns the largest value that the @c xoroshiro128plusshixostar
     * can produce.
     */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
     {
         return UINT64_MAX;
     }
 
     /** Returns the next value of the @c xoroshiro128plusshixostar. */
-    std::uint64_t operator()( )
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()( )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostar, values, 1 );
         std::uint64_t r = _s [ 0 ] + _s [ 1 ];
         next ( );
         return ((r >> 32) ^ r) * std::uint64_t { 0x1AEC805299990163 };
@@ -1470,11 +1939,12 @@ public:
     template<class Iter>
     void generate ( Iter first, Iter last )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostar, bulk_calls, 1 );
         detail::generate_from_int ( *this, first, last );
     }
 
     /** Advances the state of the generator by @c z. */
-    void discard ( std::uintmax_t z )
+    BOOST_CXX14_CONSTEXPR void discard ( std::uintmax_t z )
     {
         while ( z-- ) {
             next ( );
@@ -1487,8 +1957,9 @@ public:
     * generate 2^64 non-overlapping subsequences for parallel
     * computations.
     */
-    void jump ( std::uintmax_t z = 1 )
+    BOOST_CXX14_CONSTEXPR void jump ( std::uintmax_t z = 1 )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostar, jumps, z );
         while ( z-- ) {
             std::uint64_t s0 = 0, s1 = 0;
             for ( std::size_t b = 0; b < 64; ++b ) {
@@ -1507,13 +1978,13 @@ public:
         }
     }
 
-    friend bool operator==( const xoroshiro128plusshixostar& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator==( const xoroshiro128plusshixostar& x,
         const xoroshiro128plusshixostar& y )
     {
         return x._s [ 0 ] == y._s [ 0 ] && x._s [ 1 ] == y._s [ 1 ];
     }
 
-    friend bool operator!=( const xoroshiro128plusshixostar& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=( const xoroshiro128plusshixostar& x,
         const xoroshiro128plusshixostar& y )
     {
         return !( x == y );
@@ -1543,14 +2014,27 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME ( xoroshiro128plusshixostar, "xoroshiro128plusshixostar" )
+
+    // Constructs the engine with state (s0, s1) as is, without warmup,
+    // used by engine_bank.
+    BOOST_CXX14_CONSTEXPR xoroshiro128plusshixostar ( detail::engine_state_tag, std::uint64_t s0, std::uint64_t s1 )
+    {
+        _s [ 0 ] = s0, _s [ 1 ] = s1;
+    }
+
     // Rotate left, use of intrinsic shows no speed-up. */
-    static std::uint64_t rotl ( const std::uint64_t x, const int k )
+    static BOOST_CXX14_CONSTEXPR std::uint64_t rotl ( const std::uint64_t x, const int k )
     {
         return ( x << k ) | ( x >> ( 64 - k ) );
     }
 
     /** Advance the state by 1 step. */
-    void next ( )
+    BOOST_CXX14_CONSTEXPR void next ( )
     {
         _s [ 1 ] ^= _s [ 0 ];
         _s [ 0 ] = rotl ( _s [ 0 ], 55 );
@@ -1560,14 +2044,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup ( )
+    BOOST_CXX14_CONSTEXPR void warmup ( )
     {
         discard ( 8 );
     }
 
     /// \endcond
 
-    std::uint64_t _s [2];
+    std::uint64_t _s [2] = { };
 };
 
 
@@ -1578,12 +2062,12 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
     * Constructs a @c xoroshiro128plusshixostarshixo, using the default seed.
     */
-    xoroshiro128plusshixostarshixo ( )
+    BOOST_CXX14_CONSTEXPR xoroshiro128plusshixostarshixo ( )
     {
         seed ( );
     }
@@ -1591,7 +2075,7 @@ public:
     /**
     * Constructs a @c xoroshiro128plusshixostarshixo, seeding it with @c value.
     */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( xoroshiro128plusshixostarshixo,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR ( xoroshiro128plusshixostarshixo,
         std::uint64_t, value )
     {
         seed ( value );
@@ -1601,7 +2085,7 @@ public:
     * Constructs a @c xoroshiro128plusshixostarshixo, seeding it with values
     * produced by a call to @c seq.generate().
     */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR ( xoroshiro128plusshixostarshixo,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR ( xoroshiro128plusshixostarshixo,
         SeedSeq, seq )
     {
         seed ( seq );
@@ -1626,7 +2110,7 @@ public:
     /**
     * Calls seed(default_seed)
     */
-    void seed ( )
+    BOOST_CXX14_CONSTEXPR void seed ( )
     {
         seed ( default_seed );
     }
@@ -1635,19 +2119,21 @@ public:
     * seeds a @c xoroshiro128plusshixostarshixo with splitmix64, as per Sebastiano
     * Vigna's recommendation.
     */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( xoroshiro128plusshixostarshixo, std::uint64_t, value )
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED ( xoroshiro128plusshixostarshixo, std::uint64_t, value )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostarshixo, reseeds, 1 );
         std::uint64_t s = value + std::uint64_t { 0x9E3779B97F4A7C15 };
         _s [ 0 ] = detail::xoroshiro_integer_hash ( s );
         _s [ 1 ] = detail::xoroshiro_integer_hash ( ( s += std::uint64_t { 0x9E3779B97F4A7C15 } ) );
     }
 
     /**
-    * Seeds a @c xoroshiro128plusshixostarshixo using values from a SeedSeq. If a
-    * valid seed cannot be generated throws @c std::runtime_error.
+    * Seeds a @c xoroshiro128plusshixostarshixo using values from a SeedSeq. An
+    * all-zero state is replaced by one derived from @c seq.param().
     */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED ( xoroshiro128plusshixostarshixo, SeedSeq, seq )
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED ( xoroshiro128plusshixostarshixo, SeedSeq, seq )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostarshixo, reseeds, 1 );
         detail::seed_array_non_zero_int ( seq, _s );
         warmup ( );
     }
@@ -1664,6 +2150,7 @@ public:
     template<class It>
     void seed ( It& first, It last )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostarshixo, reseeds, 1 );
         detail::fill_array_non_zero_int ( first, last, _s );
         warmup ( );
     }
@@ -1672,7 +2159,7 @@ public:
     * Returns the smallest value that the @c xoroshiro128plusshixostarshixo
     * can produce.
     */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ( )
     {
         return 0;
     }
@@ -1681,14 +2168,15 @@ public:
     * Returns the largest value that the @c xoroshiro128plusshixostarshixo
     * can produce.
     */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ( )
     {
         return UINT64_MAX;
     }
 
     /** Returns the next value of the @c xoroshiro128plusshixostarshixo. */
-    std::uint64_t operator()( )
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()( )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostarshixo, values, 1 );
         std::uint64_t r = _s [ 0 ] + _s [ 1 ];
         next ( );
         r = ( ( r >> 32 ) ^ r ) * std::uint64_t { 0x1AEC805299990163 };
@@ -1699,11 +2187,12 @@ public:
     template<class Iter>
     void generate ( Iter first, Iter last )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostarshixo, bulk_calls, 1 );
         detail::generate_from_int ( *this, first, last );
     }
 
     /** Advances the state of the generator by @c z. */
-    void discard ( std::uintmax_t z )
+    BOOST_CXX14_CONSTEXPR void discard ( std::uintmax_t z )
     {
         while ( z-- ) {
             next ( );
@@ -1716,8 +2205,9 @@ public:
     * generate 2^64 non-overlapping subsequences for parallel
     * computations.
     */
-    void jump ( std::uintmax_t z = 1 )
+    BOOST_CXX14_CONSTEXPR void jump ( std::uintmax_t z = 1 )
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT ( xoroshiro128plusshixostarshixo, jumps, z );
         while ( z-- ) {
             std::uint64_t s0 = 0, s1 = 0;
             for ( std::size_t b = 0; b < 64; ++b ) {
@@ -1736,13 +2226,13 @@ public:
         }
     }
 
-    friend bool operator==( const xoroshiro128plusshixostarshixo& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator==( const xoroshiro128plusshixostarshixo& x,
         const xoroshiro128plusshixostarshixo& y )
     {
         return x._s [ 0 ] == y._s [ 0 ] && x._s [ 1 ] == y._s [ 1 ];
     }
 
-    friend bool operator!=( const xoroshiro128plusshixostarshixo& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=( const xoroshiro128plusshixostarshixo& x,
         const xoroshiro128plusshixostarshixo& y )
     {
         return !( x == y );
@@ -1772,14 +2262,27 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME ( xoroshiro128plusshixostarshixo, "xoroshiro128plusshixostarshixo" )
+
+    // Constructs the engine with state (s0, s1) as is, without warmup,
+    // used by engine_bank.
+    BOOST_CXX14_CONSTEXPR xoroshiro128plusshixostarshixo ( detail::engine_state_tag, std::uint64_t s0, std::uint64_t s1 )
+    {
+        _s [ 0 ] = s0, _s [ 1 ] = s1;
+    }
+
     // Rotate left, use of intrinsic shows no speed-up. */
-    static std::uint64_t rotl ( const std::uint64_t x, const int k )
+    static BOOST_CXX14_CONSTEXPR std::uint64_t rotl ( const std::uint64_t x, const int k )
     {
         return ( x << k ) | ( x >> ( 64 - k ) );
     }
 
     /** Advance the state by 1 step. */
-    void next ( )
+    BOOST_CXX14_CONSTEXPR void next ( )
     {
         _s [ 1 ] ^= _s [ 0 ];
         _s [ 0 ] = rotl ( _s [ 0 ], 55 );
@@ -1789,14 +2292,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup ( )
+    BOOST_CXX14_CONSTEXPR void warmup ( )
     {
         discard ( 8 );
     }
 
     /// \endcond
 
-    std::uint64_t _s [ 2 ];
+    std::uint64_t _s [ 2 ] = { };
 };
 
 /**
@@ -1824,18 +2327,18 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
      * Constructs a @c xorshift128plus, using the default seed.
      */
-    xorshift128plus()
+    BOOST_CXX14_CONSTEXPR xorshift128plus()
     { seed(); }
 
     /**
      * Constructs a @c xorshift128plus, seeding it with @c value.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xorshift128plus,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xorshift128plus,
                                                std::uint64_t, value)
     { seed(value); }
 
@@ -1843,7 +2346,7 @@ public:
      * Constructs a @c xorshift128plus, seeding it with values
      * produced by a call to @c seq.generate().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(xorshift128plus,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR(xorshift128plus,
                                              SeedSeq, seq)
     { seed(seq); }
 
@@ -1864,26 +2367,28 @@ public:
     /**
      * Calls seed(default_seed)
      */
-    void seed()
+    BOOST_CXX14_CONSTEXPR void seed()
     { seed(default_seed); }
 
     /**
      * seeds a @c xorshift128plus with splitmix64, as per Sebastiano
      * Vigna's recommendation.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xorshift128plus, std::uint64_t, value)
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xorshift128plus, std::uint64_t, value)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift128plus, reseeds, 1);
         std::uint64_t s = value + std::uint64_t { 0x9E3779B97F4A7C15 };
         _s[0] = detail::xoroshiro_integer_hash(s);
         _s[1] = detail::xoroshiro_integer_hash((s += std::uint64_t { 0x9E3779B97F4A7C15 }));
     }
 
     /**
-     * Seeds a @c xorshift128plus using values from a SeedSeq. If a
-     * valid seed cannot be generated throws @c std::runtime_error.
+     * Seeds a @c xorshift128plus using values from a SeedSeq. An
+     * all-zero state is replaced by one derived from @c seq.param().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(xorshift128plus, SeedSeq, seq)
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED(xorshift128plus, SeedSeq, seq)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift128plus, reseeds, 1);
         detail::seed_array_non_zero_int(seq, _s);
         warmup();
     }
@@ -1900,6 +2405,7 @@ public:
     template<class It>
     void seed(It& first, It last)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift128plus, reseeds, 1);
         detail::fill_array_non_zero_int(first, last, _s);
         warmup();
     }
@@ -1908,19 +2414,20 @@ public:
      * Returns the smallest value that the @c xorshift128plus
      * can produce.
      */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return 0; }
 
     /**
      * Returns the largest value that the @c xorshift128plus
      * can produce.
      */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return UINT64_MAX; }
 
     /** Returns the next value of the @c xorshift128plus. */
-    std::uint64_t operator()()
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()()
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift128plus, values, 1);
         const std::uint64_t r = _s[0] + _s[1];
         next();
         return r;
@@ -1929,10 +2436,13 @@ public:
     /** Fills a range with random values. */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift128plus, bulk_calls, 1);
+        detail::generate_from_int(*this, first, last);
+    }
 
     /** Advances the state of the generator by @c z. */
-    void discard(std::uintmax_t z)
+    BOOST_CXX14_CONSTEXPR void discard(std::uintmax_t z)
     {
         while (z--) {
             next();
@@ -1945,9 +2455,10 @@ public:
      * generate 2^64 non-overlapping subsequences for parallel
      * computations.
      */
-    void jump(std::uintmax_t z = 1)
+    BOOST_CXX14_CONSTEXPR void jump(std::uintmax_t z = 1)
     {
-        static const std::uint64_t jmp [2] {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift128plus, jumps, z);
+        const std::uint64_t jmp [2] {
             0x8a5cd789635d2dff, 0x121fd2155c472f96
         };
 
@@ -1965,11 +2476,11 @@ public:
         }
     }
 
-    friend bool operator==(const xorshift128plus& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator==(const xorshift128plus& x,
                            const xorshift128plus& y)
     { return x._s[0] == y._s[0] && x._s[1] == y._s[1]; }
 
-    friend bool operator!=(const xorshift128plus& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=(const xorshift128plus& x,
                            const xorshift128plus& y)
     { return !(x == y); }
 
@@ -1997,8 +2508,14 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(xorshift128plus, "xorshift128plus")
+
     /** Advance the state by 1 step. */
-    void next()
+    BOOST_CXX14_CONSTEXPR void next()
     {
         std::uint64_t s1 = _s[0];
         _s[0] = _s[1];
@@ -2007,14 +2524,14 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup()
+    BOOST_CXX14_CONSTEXPR void warmup()
     {
         discard(8);
     }
 
     /// \endcond
 
-    std::uint64_t _s[2];
+    std::uint64_t _s[2] = { };
 };
 
 
@@ -2044,18 +2561,18 @@ public:
 
     // Required for old Boost.Random concept.
     static const bool has_fixed_range = true;
-    static const std::uint64_t default_seed = 1;
+    static BOOST_CONSTEXPR_OR_CONST std::uint64_t default_seed = 1;
 
     /**
      * Constructs a @c xorshift1024star, using the default seed.
      */
-    xorshift1024star()
+    BOOST_CXX14_CONSTEXPR xorshift1024star()
     { seed(); }
 
     /**
      * Constructs a @c xorshift1024star, seeding it with @c value.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xorshift1024star,
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(xorshift1024star,
                                                std::uint64_t, value)
     { seed(value); }
 
@@ -2063,7 +2580,7 @@ public:
      * Constructs a @c xorshift1024star, seeding it with values
      * produced by a call to @c seq.generate().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(xorshift1024star,
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR(xorshift1024star,
                                              SeedSeq, seq)
     { seed(seq); }
 
@@ -2084,15 +2601,16 @@ public:
     /**
      * Calls seed(default_seed)
      */
-    void seed()
+    BOOST_CXX14_CONSTEXPR void seed()
     { seed(default_seed); }
 
     /**
      * seeds a @c xorshift1024star with splitmix64, as per Sebastiano
      * Vigna's recommendation.
      */
-    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xorshift1024star, std::uint64_t, value)
+    BOOST_CXX14_CONSTEXPR BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(xorshift1024star, std::uint64_t, value)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift1024star, reseeds, 1);
         std::uint64_t s = value + std::uint64_t { 0x9E3779B97F4A7C15 };
         _s[0] = detail::xoroshiro_integer_hash(s);
         for (std::size_t i = 1; i < 16; ++i) {
@@ -2102,11 +2620,12 @@ public:
     }
 
     /**
-     * Seeds a @c xorshift1024star using values from a SeedSeq. If a
-     * valid seed cannot be generated throws @c std::runtime_error.
+     * Seeds a @c xorshift1024star using values from a SeedSeq. An
+     * all-zero state is replaced by one derived from @c seq.param().
      */
-    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(xorshift1024star, SeedSeq, seq)
+    BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED(xorshift1024star, SeedSeq, seq)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift1024star, reseeds, 1);
         detail::seed_array_non_zero_int(seq, _s);
         _p = 0;
         warmup();
@@ -2124,6 +2643,7 @@ public:
     template<class It>
     void seed(It& first, It last)
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift1024star, reseeds, 1);
         detail::fill_array_non_zero_int(first, last, _s);
         _p = 0;
         warmup();
@@ -2133,19 +2653,20 @@ public:
      * Returns the smallest value that the @c xorshift1024star
      * can produce.
      */
-    static result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return 0; }
 
     /**
      * Returns the largest value that the @c xorshift1024star
      * can produce.
      */
-    static result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
     { return UINT64_MAX; }
 
     /** Returns the next value of the @c xorshift1024star. */
-    std::uint64_t operator()()
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator()()
     {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift1024star, values, 1);
         next();
         return _s[_p] * std::uint64_t { 0x106689D45497FDB5 };
     }
@@ -2153,10 +2674,13 @@ public:
     /** Fills a range with random values. */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift1024star, bulk_calls, 1);
+        detail::generate_from_int(*this, first, last);
+    }
 
     /** Advances the state of the generator by @c z. */
-    void discard(std::uintmax_t z)
+    BOOST_CXX14_CONSTEXPR void discard(std::uintmax_t z)
     {
         while (z--) {
             next();
@@ -2169,9 +2693,10 @@ public:
      * generate 2^512 non-overlapping subsequences for parallel
      * computations.
      */
-    void jump(std::uintmax_t z = 1)
+    BOOST_CXX14_CONSTEXPR void jump(std::uintmax_t z = 1)
     {
-        static const std::uint64_t jmp[16] {
+        BOOST_RANDOM_DETAIL_INSTRUMENT(xorshift1024star, jumps, z);
+        const std::uint64_t jmp[16] {
             0x84242F96ECA9C41D, 0xA3C65B8776F96855,
             0x5B34A39F070B5837, 0x4489AFFCE4F31A1E,
             0x2FFEEB0A48316F40, 0xDC2D9891FE68C022,
@@ -2183,7 +2708,7 @@ public:
         };
 
         while(z--) {
-            std::uint64_t t[16];
+            std::uint64_t t[16] = { };
             for (std::size_t i = 0; i < 16; ++i) {
                 for (std::size_t b = 0; b < 64; ++b) {
                     if (jmp[i] & std::uint64_t { 1 } << b) {
@@ -2200,7 +2725,7 @@ public:
         }
     }
 
-    friend bool operator==(const xorshift1024star& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator==(const xorshift1024star& x,
         const xorshift1024star& y)
     {
         std::size_t i = x._p, j = y._p;
@@ -2218,7 +2743,7 @@ public:
         return true;
     }
 
-    friend bool operator!=(const xorshift1024star& x,
+    friend BOOST_CXX14_CONSTEXPR bool operator!=(const xorshift1024star& x,
                            const xorshift1024star& y)
     { return !(x == y); }
 
@@ -2256,8 +2781,14 @@ private:
 
     /// \cond show_private
 
+    template<class Engine>
+    friend struct detail::engine_access;
+    template<class Engine>
+    friend struct detail::binary_state_access;
+    BOOST_RANDOM_DETAIL_INSTRUMENTATION_NAME(xorshift1024star, "xorshift1024star")
+
     /** Advance the state by 1 step. */
-    void next()
+    BOOST_CXX14_CONSTEXPR void next()
     {
         const std::uint64_t s0 = _s[_p];
         std::uint64_t s1 = _s[(_p = (_p + 1) & 15)];
@@ -2266,19 +2797,23 @@ private:
     }
 
     // As per http://www0.cs.ucl.ac.uk/staff/D.Jones/GoodPracticeRNG.pdf
-    void warmup()
+    BOOST_CXX14_CONSTEXPR void warmup()
     {
         discard(64);
     }
 
     /// \endcond
 
-    std::uint64_t _s[16];
-    std::size_t _p;
+    std::uint64_t _s[16] = { };
+    std::size_t _p = 0;
 };
 
 #endif /* !BOOST_NO_INT64_T && !BOOST_NO_INTEGRAL_INT64_T */
 
+#undef BOOST_RANDOM_SPLITMIX64_LANES
+#undef BOOST_RANDOM_XOROSHIRO_SEED_SEQ_SEED
+#undef BOOST_RANDOM_XOROSHIRO_SEED_SEQ_CONSTRUCTOR
+
 } // namespace random
 } // namespace boost
 
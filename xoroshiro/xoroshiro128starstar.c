@@ -8,6 +8,8 @@ See <http://creativecommons.org/publicdomain/zero/1.0/>. */
 
 #include <stdint.h>
 
+#include "xoro.h"
+
 /* This is xoroshiro128** 1.0, our all-purpose, rock-solid, small-state
    generator. It is extremely (sub-ns) fast and it passes all tests we are
    aware of, but its state space is large enough only for mild parallelism.
@@ -25,9 +27,7 @@ static inline uint64_t rotl(const uint64_t x, int k) {
 }
 
 
-static uint64_t s[2];
-
-uint64_t next(void) {
+static inline uint64_t state_next(uint64_t *const s) {
 	const uint64_t s0 = s[0];
 	uint64_t s1 = s[1];
 	const uint64_t result = rotl(s0 * 5, 7) * 9;
@@ -44,7 +44,7 @@ uint64_t next(void) {
    to 2^64 calls to next(); it can be used to generate 2^64
    non-overlapping subsequences for parallel computations. */
 
-void jump(void) {
+static void state_jump(uint64_t *const s) {
 	static const uint64_t JUMP[] = { 0xdf900294d8f554a5, 0x170865df4b3201fc };
 
 	uint64_t s0 = 0;
@@ -55,7 +55,7 @@ void jump(void) {
 				s0 ^= s[0];
 				s1 ^= s[1];
 			}
-			next();
+			state_next(s);
 		}
 
 	s[0] = s0;
@@ -68,7 +68,7 @@ void jump(void) {
    from each of which jump() will generate 2^32 non-overlapping
    subsequences for parallel distributed computations. */
 
-void long_jump(void) {
+static void state_long_jump(uint64_t *const s) {
 	static const uint64_t LONG_JUMP[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
 
 	uint64_t s0 = 0;
@@ -79,9 +79,59 @@ void long_jump(void) {
 				s0 ^= s[0];
 				s1 ^= s[1];
 			}
-			next();
+			state_next(s);
 		}
 
 	s[0] = s0;
 	s[1] = s1;
 }
+
+
+/* The reentrant interface of xoro.h, the state is passed in. */
+
+uint64_t xoroshiro128starstar_next(xoro_state_t *state) {
+	return state_next(state->s);
+}
+
+/* The state is copied to locals, which stay in registers in the loop. */
+
+void xoroshiro128starstar_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n) {
+	uint64_t s[2] = { state->s[0], state->s[1] };
+
+	for(size_t i = 0; i < n; i++)
+		buf[i] = state_next(s);
+
+	state->s[0] = s[0];
+	state->s[1] = s[1];
+}
+
+void xoroshiro128starstar_jump_n(xoro_state_t *state, uint64_t n) {
+	while(n--)
+		state_jump(state->s);
+}
+
+void xoroshiro128starstar_long_jump(xoro_state_t *state) {
+	state_long_jump(state->s);
+}
+
+
+/* The original interface, on a single static state, which is not
+   reentrant. */
+
+#if defined(XORO_GLOBAL_STATE)
+
+static uint64_t s[2];
+
+uint64_t next(void) {
+	return state_next(s);
+}
+
+void jump(void) {
+	state_jump(s);
+}
+
+void long_jump(void) {
+	state_long_jump(s);
+}
+
+#endif
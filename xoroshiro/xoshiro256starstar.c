@@ -8,6 +8,8 @@ See <http://creativecommons.org/publicdomain/zero/1.0/>. */
 
 #include <stdint.h>
 
+#include "xoro.h"
+
 /* This is xoshiro256** 1.0, our all-purpose, rock-solid generator. It has
    excellent (sub-ns) speed, a state (256 bits) that is large enough for
    any parallel application, and it passes all tests we are aware of.
@@ -23,9 +25,7 @@ static inline uint64_t rotl(const uint64_t x, int k) {
 }
 
 
-static uint64_t s[4];
-
-uint64_t next(void) {
+static inline uint64_t state_next(uint64_t *const s) {
 	const uint64_t result_starstar = rotl(s[1] * 5, 7) * 9;
 
 	const uint64_t t = s[1] << 17;
@@ -47,7 +47,7 @@ uint64_t next(void) {
    to 2^128 calls to next(); it can be used to generate 2^128
    non-overlapping subsequences for parallel computations. */
 
-void jump(void) {
+static void state_jump(uint64_t *const s) {
 	static const uint64_t JUMP[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
 
 	uint64_t s0 = 0;
@@ -62,7 +62,7 @@ void jump(void) {
 				s2 ^= s[2];
 				s3 ^= s[3];
 			}
-			next();
+			state_next(s);
 		}
 
 	s[0] = s0;
@@ -78,7 +78,7 @@ void jump(void) {
    from each of which jump() will generate 2^64 non-overlapping
    subsequences for parallel distributed computations. */
 
-void long_jump(void) {
+static void state_long_jump(uint64_t *const s) {
 	static const uint64_t LONG_JUMP[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
 
 	uint64_t s0 = 0;
@@ -93,7 +93,7 @@ void long_jump(void) {
 				s2 ^= s[2];
 				s3 ^= s[3];
 			}
-			next();
+			state_next(s);
 		}
 
 	s[0] = s0;
@@ -101,3 +101,55 @@ void long_jump(void) {
 	s[2] = s2;
 	s[3] = s3;
 }
+
+
+/* The reentrant interface of xoro.h, the state is passed in. */
+
+uint64_t xoshiro256starstar_next(xoro_state_t *state) {
+	return state_next(state->s);
+}
+
+/* The state is copied to locals, which stay in registers in the loop. */
+
+void xoshiro256starstar_fill_u64(xoro_state_t *state, uint64_t *buf, size_t n) {
+	uint64_t s[4] = { state->s[0], state->s[1], state->s[2], state->s[3] };
+
+	for(size_t i = 0; i < n; i++)
+		buf[i] = state_next(s);
+
+	state->s[0] = s[0];
+	state->s[1] = s[1];
+	state->s[2] = s[2];
+	state->s[3] = s[3];
+}
+
+void xoshiro256starstar_jump_n(xoro_state_t *state, uint64_t n) {
+	while(n--)
+		state_jump(state->s);
+}
+
+void xoshiro256starstar_long_jump(xoro_state_t *state) {
+	state_long_jump(state->s);
+}
+
+
+/* The original interface, on a single static state, which is not
+   reentrant. */
+
+#if defined(XORO_GLOBAL_STATE)
+
+static uint64_t s[4];
+
+uint64_t next(void) {
+	return state_next(s);
+}
+
+void jump(void) {
+	state_jump(s);
+}
+
+void long_jump(void) {
+	state_long_jump(s);
+}
+
+#endif
@@ -0,0 +1,580 @@
+/* boost random/ziggurat.hpp header file
+ *
+ * Copyright degski 2017-2018
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_ZIGGURAT_HPP
+#define BOOST_RANDOM_ZIGGURAT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "generate_canonical_bulk.hpp"
+#include "uniform_bounded.hpp"
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+    /**
+     * The 256 layers of a ziggurat, x[0] is the width of the base layer
+     * (the area v of a layer divided by f(r)), x[1] = r and x[256] = 0,
+     * f[i] = f(x[i]).
+     */
+    struct ziggurat_table
+    {
+        double x[257];
+        double f[257];
+    };
+
+    /**
+     * The normal density exp(-x * x / 2), with r and v of Marsaglia and
+     * Tsang for 256 layers.
+     */
+    struct ziggurat_normal_tag
+    {
+        static const bool symmetric = true;
+
+        static double r() { return 3.6541528853610088; }
+        static double v() { return 0.00492867323399; }
+
+        static double pdf(double x) { using std::exp; return exp(-0.5 * x * x); }
+        static double inverse_pdf(double y) { using std::log; using std::sqrt; return sqrt(-2.0 * log(y)); }
+
+        // Marsaglia's tail method, a variate beyond r.
+        template<class Engine>
+        static double tail(Engine& eng)
+        {
+            using std::log;
+            double x, y;
+            do {
+                x = log(open_uniform(eng)) / r();
+                y = log(open_uniform(eng));
+            } while (-2.0 * y < x * x);
+            return r() - x;
+        }
+
+        template<class Engine>
+        static double open_uniform(Engine& eng)
+        {
+            return (static_cast<double>(bounded_bits(eng, boost::false_type()) >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+        }
+    };
+
+    /** The exponential density exp(-x), 256 layers. */
+    struct ziggurat_exponential_tag
+    {
+        static const bool symmetric = false;
+
+        static double r() { return 7.69711747013104972; }
+        static double v() { return 0.0039496598225815571993; }
+
+        static double pdf(double x) { using std::exp; return exp(-x); }
+        static double inverse_pdf(double y) { using std::log; return -log(y); }
+
+        // The exponential distribution is memoryless.
+        template<class Engine>
+        static double tail(Engine& eng)
+        {
+            using std::log;
+            return r() - log(ziggurat_normal_tag::open_uniform(eng));
+        }
+    };
+
+    // The table of Tag, computed on first use.
+    template<class Tag>
+    inline const ziggurat_table& get_ziggurat_table()
+    {
+        struct init
+        {
+            static ziggurat_table make()
+            {
+                ziggurat_table t;
+                t.x[0] = Tag::v() / Tag::pdf(Tag::r());
+                t.x[1] = Tag::r();
+                for (int i = 2; i < 256; ++i) {
+                    t.x[i] = Tag::inverse_pdf(Tag::v() / t.x[i - 1] + Tag::pdf(t.x[i - 1]));
+                }
+                t.x[256] = 0.0;
+                for (int i = 0; i < 257; ++i) {
+                    t.f[i] = Tag::pdf(t.x[i]);
+                }
+                return t;
+            }
+        };
+        static const ziggurat_table table = init::make();
+        return table;
+    }
+
+    /*
+     * The layout of the 64 random bits: the top 8 bits select the layer,
+     * bit 55 is the sign (normal only) and bits [3, 55) are the mantissa
+     * of a uniform in [0, 1). The lowest 3 bits, the weakest of the
+     * xoroshiro+ engines, are not used.
+     */
+    const std::uint64_t ziggurat_mantissa_mask = (std::uint64_t { 1 } << 52) - 1;
+
+    inline double ziggurat_uniform(std::uint64_t bits)
+    {
+        return static_cast<double>((bits >> 3) & ziggurat_mantissa_mask) * (1.0 / 4503599627370496.0);
+    }
+
+    // x with the sign of bit 55, without a branch on the (random) sign.
+    inline double ziggurat_signed(double x, std::uint64_t bits)
+    {
+        std::uint64_t u;
+        std::memcpy(&u, &x, sizeof(u));
+        u ^= (bits << 8) & 0x8000000000000000;
+        std::memcpy(&x, &u, sizeof(x));
+        return x;
+    }
+
+    /**
+     * The rectangle test, true if bits fall inside the rectangle of its
+     * layer, z is the variate.
+     */
+    template<class Tag>
+    inline bool ziggurat_rectangle(const ziggurat_table& t, std::uint64_t bits, double& z)
+    {
+        const std::size_t i = static_cast<std::size_t>(bits >> 56);
+        const double x = ziggurat_uniform(bits) * t.x[i];
+        z = Tag::symmetric ? ziggurat_signed(x, bits) : x;
+        return x < t.x[i + 1];
+    }
+
+    /**
+     * A variate from bits, more bits are taken from eng if bits fall
+     * outside the rectangle of its layer.
+     */
+    template<class Tag, class Engine>
+    double ziggurat_sample(const ziggurat_table& t, Engine& eng, std::uint64_t bits)
+    {
+        for (;;) {
+            const std::size_t i = static_cast<std::size_t>(bits >> 56);
+            const bool negative = Tag::symmetric && ((bits >> 55) & 1);
+            const double x = ziggurat_uniform(bits) * t.x[i];
+            if (x < t.x[i + 1]) {
+                return negative ? -x : x;
+            }
+            if (i == 0) {
+                const double y = Tag::tail(eng);
+                return negative ? -y : y;
+            }
+            const double u = static_cast<double>(bounded_bits(eng, boost::false_type()) >> 11) * (1.0 / 9007199254740992.0);
+            if (t.f[i + 1] + (t.f[i] - t.f[i + 1]) * u < Tag::pdf(x)) {
+                return negative ? -x : x;
+            }
+            bits = bounded_bits(eng, boost::false_type());
+        }
+    }
+
+    /**
+     * The rectangle test of ziggurat_sample() on the block bits, the
+     * indices of the variates that need the wedge or tail are written to
+     * rejected, the number of those is returned.
+     */
+    template<class Tag>
+    std::size_t ziggurat_block(const ziggurat_table& t, const std::uint64_t* bits, double* out, std::size_t* rejected, std::size_t n)
+    {
+        std::size_t count = 0, i = 0;
+#if defined(__AVX512F__)
+        const __m512i mantissa8 = _mm512_set1_epi64(static_cast<long long>(ziggurat_mantissa_mask));
+        const __m512i one8 = _mm512_set1_epi64(0x3FF0000000000000);
+        const __m512i sign8 = _mm512_set1_epi64(static_cast<long long>(Tag::symmetric ? 0x8000000000000000 : 0));
+        for (; i + 8 <= n; i += 8) {
+            const __m512i b = _mm512_loadu_si512(bits + i);
+            const __m512i layer = _mm512_srli_epi64(b, 56);
+            // The mantissa in [1, 2), minus 1 is exact.
+            const __m512i m = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi64(b, 3), mantissa8), one8);
+            const __m512d u = _mm512_sub_pd(_mm512_castsi512_pd(m), _mm512_set1_pd(1.0));
+            const __m512d x = _mm512_mul_pd(u, _mm512_i64gather_pd(layer, t.x, 8));
+            const __mmask8 mask = _mm512_cmp_pd_mask(x, _mm512_i64gather_pd(layer, t.x + 1, 8), _CMP_NLT_UQ);
+            const __m512i sign = _mm512_and_si512(_mm512_slli_epi64(b, 8), sign8);
+            _mm512_storeu_pd(out + i, _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x), sign)));
+            if (mask) {
+                for (std::size_t j = 0; j < 8; ++j) {
+                    if ((mask >> j) & 1) {
+                        rejected[count++] = i + j;
+                    }
+                }
+            }
+        }
+#elif defined(__AVX2__)
+        const __m256i mantissa4 = _mm256_set1_epi64x(static_cast<long long>(ziggurat_mantissa_mask));
+        const __m256i one4 = _mm256_set1_epi64x(0x3FF0000000000000);
+        const __m256i sign4 = _mm256_set1_epi64x(static_cast<long long>(Tag::symmetric ? 0x8000000000000000 : 0));
+        for (; i + 4 <= n; i += 4) {
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + i));
+            const __m256i layer = _mm256_srli_epi64(b, 56);
+            const __m256i m = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi64(b, 3), mantissa4), one4);
+            const __m256d u = _mm256_sub_pd(_mm256_castsi256_pd(m), _mm256_set1_pd(1.0));
+            const __m256d x = _mm256_mul_pd(u, _mm256_i64gather_pd(t.x, layer, 8));
+            const int mask = _mm256_movemask_pd(_mm256_cmp_pd(x, _mm256_i64gather_pd(t.x + 1, layer, 8), _CMP_NLT_UQ));
+            const __m256i sign = _mm256_and_si256(_mm256_slli_epi64(b, 8), sign4);
+            _mm256_storeu_pd(out + i, _mm256_castsi256_pd(_mm256_xor_si256(_mm256_castpd_si256(x), sign)));
+            if (mask) {
+                for (std::size_t j = 0; j < 4; ++j) {
+                    if ((mask >> j) & 1) {
+                        rejected[count++] = i + j;
+                    }
+                }
+            }
+        }
+#endif
+        for (; i < n; ++i) {
+            if (!ziggurat_rectangle<Tag>(t, bits[i], out[i])) {
+                rejected[count++] = i;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Writes n variates of Tag, scaled as a + b * z, to out. The bits are
+     * obtained in blocks, through generate() if the engine has a
+     * vectorized one, the rejected variates are completed at the end of
+     * each block, in order.
+     */
+    template<class Tag, class RealType, class Engine, class OutputIt>
+    void ziggurat_generate(const ziggurat_table& t, Engine& eng, OutputIt out, std::size_t n, RealType a, RealType b)
+    {
+        std::uint64_t bits[canonical_block_size];
+        double z[canonical_block_size];
+        std::size_t rejected[canonical_block_size];
+        while (n) {
+            const std::size_t m = (std::min)(n, canonical_block_size);
+            canonical_bits(eng, bits, m, canonical_by_generate<Engine>());
+            const std::size_t count = ziggurat_block<Tag>(t, bits, z, rejected, m);
+            for (std::size_t r = 0; r < count; ++r) {
+                z[rejected[r]] = ziggurat_sample<Tag>(t, eng, bits[rejected[r]]);
+            }
+            for (std::size_t i = 0; i < m; ++i, ++out) {
+                *out = a + b * static_cast<RealType>(z[i]);
+            }
+            n -= m;
+        }
+    }
+
+} // namespace detail
+
+/**
+ * Instantiations of class template ziggurat_normal_distribution model a
+ * \random_distribution. Such a distribution produces random numbers
+ * @c x distributed with probability density function
+ * \f$\displaystyle p(x) =
+ *   \frac{1}{\sqrt{2\pi}\sigma} e^{-\frac{(x-\mu)^2}{2\sigma^2}}
+ * \f$,
+ * where mean and sigma are the parameters of the distribution.
+ *
+ * The variates are sampled with a 256 layer ziggurat directly from the
+ * 64-bit outputs of the engine (two 32-bit outputs are combined, the
+ * first in the low word): the top 8 bits select the layer, bit 55 is the
+ * sign and bits [3, 55) the position in the layer. About 99% of the
+ * variates take a single output, a multiplication and a comparison.
+ *
+ * generate() writes many variates at once, the rectangle test runs on 4
+ * (AVX2) or 8 (AVX-512) variates at a time, the results do not depend on
+ * the instruction set.
+ */
+template<class RealType = double>
+class ziggurat_normal_distribution
+{
+public:
+    typedef RealType input_type;
+    typedef RealType result_type;
+
+    BOOST_STATIC_ASSERT(boost::is_floating_point<RealType>::value);
+
+    class param_type
+    {
+    public:
+        typedef ziggurat_normal_distribution distribution_type;
+
+        /**
+         * Constructs a @c param_type with a given mean and
+         * standard deviation.
+         *
+         * Requires: sigma >= 0
+         */
+        explicit param_type(RealType mean_arg = RealType(0.0),
+                            RealType sigma_arg = RealType(1.0))
+          : _mean(mean_arg),
+            _sigma(sigma_arg)
+        {}
+
+        /** Returns the mean of the distribution. */
+        RealType mean() const { return _mean; }
+
+        /** Returns the standand deviation of the distribution. */
+        RealType sigma() const { return _sigma; }
+
+        /** Returns true if the two sets of parameters are the same. */
+        friend bool operator==(const param_type& lhs, const param_type& rhs)
+        { return lhs._mean == rhs._mean && lhs._sigma == rhs._sigma; }
+
+        /** Returns true if the two sets of parameters are the different. */
+        friend bool operator!=(const param_type& lhs, const param_type& rhs)
+        { return !(lhs == rhs); }
+
+    private:
+        RealType _mean;
+        RealType _sigma;
+    };
+
+    /**
+     * Constructs a @c ziggurat_normal_distribution object. @c mean and
+     * @c sigma are the parameters for the distribution.
+     *
+     * Requires: sigma >= 0
+     */
+    explicit ziggurat_normal_distribution(const RealType& mean_arg = RealType(0.0),
+                                          const RealType& sigma_arg = RealType(1.0))
+      : _mean(mean_arg), _sigma(sigma_arg),
+        _table(&detail::get_ziggurat_table<detail::ziggurat_normal_tag>())
+    {
+        BOOST_ASSERT(_sigma >= RealType(0));
+    }
+
+    /**
+     * Constructs a @c ziggurat_normal_distribution object from its
+     * parameters.
+     */
+    explicit ziggurat_normal_distribution(const param_type& parm)
+      : _mean(parm.mean()), _sigma(parm.sigma()),
+        _table(&detail::get_ziggurat_table<detail::ziggurat_normal_tag>())
+    {}
+
+    /** Returns the mean of the distribution. */
+    RealType mean() const { return _mean; }
+    /** Returns the standard deviation of the distribution. */
+    RealType sigma() const { return _sigma; }
+
+    /** Returns the smallest value that the distribution can produce. */
+    RealType min BOOST_PREVENT_MACRO_SUBSTITUTION () const
+    { return -std::numeric_limits<RealType>::infinity(); }
+    /** Returns the largest value that the distribution can produce. */
+    RealType max BOOST_PREVENT_MACRO_SUBSTITUTION () const
+    { return std::numeric_limits<RealType>::infinity(); }
+
+    /** Returns the parameters of the distribution. */
+    param_type param() const { return param_type(_mean, _sigma); }
+    /** Sets the parameters of the distribution. */
+    void param(const param_type& parm)
+    {
+        _mean = parm.mean();
+        _sigma = parm.sigma();
+    }
+
+    /**
+     * Effects: Subsequent uses of the distribution do not depend
+     * on values produced by any engine prior to invoking reset.
+     */
+    void reset() { }
+
+    /**  Returns a normal variate. */
+    template<class Engine>
+    result_type operator()(Engine& eng) const
+    {
+        // The rectangle test inline, the engine stays in registers.
+        const std::uint64_t bits = detail::bounded_bits(eng, boost::false_type());
+        double z;
+        if (!detail::ziggurat_rectangle<detail::ziggurat_normal_tag>(*_table, bits, z)) {
+            z = detail::ziggurat_sample<detail::ziggurat_normal_tag>(*_table, eng, bits);
+        }
+        return _mean + _sigma * static_cast<RealType>(z);
+    }
+
+    /** Returns a normal variate with parameters specified by @c param. */
+    template<class Engine>
+    result_type operator()(Engine& eng, const param_type& parm) const
+    {
+        return ziggurat_normal_distribution(parm)(eng);
+    }
+
+    /** Writes @c n normal variates to @c out. */
+    template<class Engine, class OutputIt>
+    void generate(Engine& eng, OutputIt out, std::size_t n) const
+    {
+        detail::ziggurat_generate<detail::ziggurat_normal_tag>(*_table, eng, out, n, _mean, _sigma);
+    }
+
+    /**
+     * Returns true if the two instances of @c ziggurat_normal_distribution
+     * will return identical sequences of values given equal generators.
+     */
+    friend bool operator==(const ziggurat_normal_distribution& lhs, const ziggurat_normal_distribution& rhs)
+    { return lhs._mean == rhs._mean && lhs._sigma == rhs._sigma; }
+
+    /**
+     * Returns true if the two instances of @c ziggurat_normal_distribution
+     * will return different sequences of values given equal generators.
+     */
+    friend bool operator!=(const ziggurat_normal_distribution& lhs, const ziggurat_normal_distribution& rhs)
+    { return !(lhs == rhs); }
+
+private:
+    RealType _mean, _sigma;
+    const detail::ziggurat_table* _table;
+};
+
+/**
+ * The exponential distribution is a model of \random_distribution with
+ * a single parameter lambda.
+ *
+ * It has \f$\displaystyle p(x) = \lambda e^{-\lambda x}\f$
+ *
+ * The variates are sampled with a 256 layer ziggurat, as those of
+ * ziggurat_normal_distribution, bit 55 is not used.
+ */
+template<class RealType = double>
+class ziggurat_exponential_distribution
+{
+public:
+    typedef RealType input_type;
+    typedef RealType result_type;
+
+    BOOST_STATIC_ASSERT(boost::is_floating_point<RealType>::value);
+
+    class param_type
+    {
+    public:
+        typedef ziggurat_exponential_distribution distribution_type;
+
+        /**
+         * Constructs parameters with a given lambda.
+         *
+         * Requires: lambda > 0
+         */
+        param_type(RealType lambda_arg = RealType(1.0))
+          : _lambda(lambda_arg) { BOOST_ASSERT(_lambda > RealType(0)); }
+
+        /** Returns the lambda parameter of the distribution. */
+        RealType lambda() const { return _lambda; }
+
+        /** Returns true if the two sets of parameters are equal. */
+        friend bool operator==(const param_type& lhs, const param_type& rhs)
+        { return lhs._lambda == rhs._lambda; }
+
+        /** Returns true if the two sets of parameters are different. */
+        friend bool operator!=(const param_type& lhs, const param_type& rhs)
+        { return !(lhs == rhs); }
+
+    private:
+        RealType _lambda;
+    };
+
+    /**
+     * Constructs a ziggurat_exponential_distribution with a given lambda.
+     *
+     * Requires: lambda > 0
+     */
+    explicit ziggurat_exponential_distribution(RealType lambda_arg = RealType(1.0))
+      : _lambda(lambda_arg),
+        _table(&detail::get_ziggurat_table<detail::ziggurat_exponential_tag>())
+    {
+        BOOST_ASSERT(_lambda > RealType(0));
+    }
+
+    /**
+     * Constructs a ziggurat_exponential_distribution from its parameters
+     */
+    explicit ziggurat_exponential_distribution(const param_type& parm)
+      : _lambda(parm.lambda()),
+        _table(&detail::get_ziggurat_table<detail::ziggurat_exponential_tag>())
+    {}
+
+    /** Returns the lambda parameter of the distribution. */
+    RealType lambda() const { return _lambda; }
+
+    /** Returns the smallest value that the distribution can produce. */
+    RealType min BOOST_PREVENT_MACRO_SUBSTITUTION () const
+    { return RealType(0); }
+    /** Returns the largest value that the distribution can produce. */
+    RealType max BOOST_PREVENT_MACRO_SUBSTITUTION () const
+    { return std::numeric_limits<RealType>::infinity(); }
+
+    /** Returns the parameters of the distribution. */
+    param_type param() const { return param_type(_lambda); }
+    /** Sets the parameters of the distribution. */
+    void param(const param_type& parm) { _lambda = parm.lambda(); }
+
+    /**
+     * Effects: Subsequent uses of the distribution do not depend
+     * on values produced by any engine prior to invoking reset.
+     */
+    void reset() { }
+
+    /** Returns an exponential variate. */
+    template<class Engine>
+    result_type operator()(Engine& eng) const
+    {
+        // The rectangle test inline, the engine stays in registers.
+        const std::uint64_t bits = detail::bounded_bits(eng, boost::false_type());
+        double z;
+        if (!detail::ziggurat_rectangle<detail::ziggurat_exponential_tag>(*_table, bits, z)) {
+            z = detail::ziggurat_sample<detail::ziggurat_exponential_tag>(*_table, eng, bits);
+        }
+        return static_cast<RealType>(z) * (RealType(1) / _lambda);
+    }
+
+    /**
+     * Returns an exponential variate with parameters specified by @c param.
+     */
+    template<class Engine>
+    result_type operator()(Engine& eng, const param_type& parm) const
+    {
+        return ziggurat_exponential_distribution(parm)(eng);
+    }
+
+    /** Writes @c n exponential variates to @c out. */
+    template<class Engine, class OutputIt>
+    void generate(Engine& eng, OutputIt out, std::size_t n) const
+    {
+        detail::ziggurat_generate<detail::ziggurat_exponential_tag>(*_table, eng, out, n, RealType(0), RealType(1) / _lambda);
+    }
+
+    /**
+     * Returns true iff the two distributions will produce identical
+     * sequences of values given equal generators.
+     */
+    friend bool operator==(const ziggurat_exponential_distribution& lhs, const ziggurat_exponential_distribution& rhs)
+    { return lhs._lambda == rhs._lambda; }
+
+    /**
+     * Returns true iff the two distributions could produce different
+     * sequences of values given equal generators.
+     */
+    friend bool operator!=(const ziggurat_exponential_distribution& lhs, const ziggurat_exponential_distribution& rhs)
+    { return !(lhs == rhs); }
+
+private:
+    RealType _lambda;
+    const detail::ziggurat_table* _table;
+};
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_ZIGGURAT_HPP